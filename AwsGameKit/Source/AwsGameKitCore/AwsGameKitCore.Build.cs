@@ -26,6 +26,25 @@ public class AwsGameKitCore : ModuleRules
             }
         );
 
+        // Log filtering per build configuration, see AwsGameKitCore.h.
+        // LogAwsGameKit messages above the compile time verbosity are compiled out, and native messages below the minimum level are dropped
+        // before they are converted, so Shipping builds do not pay for formatting the Display messages of the feature calls.
+        if (Target.Configuration == UnrealTargetConfiguration.Shipping)
+        {
+            PublicDefinitions.Add("AWSGAMEKIT_LOG_COMPILE_TIME_VERBOSITY=Warning");
+            PublicDefinitions.Add("AWSGAMEKIT_NATIVE_LOG_MIN_LEVEL=3");
+        }
+        else if (Target.Configuration == UnrealTargetConfiguration.Test)
+        {
+            PublicDefinitions.Add("AWSGAMEKIT_LOG_COMPILE_TIME_VERBOSITY=Display");
+            PublicDefinitions.Add("AWSGAMEKIT_NATIVE_LOG_MIN_LEVEL=2");
+        }
+        else
+        {
+            PublicDefinitions.Add("AWSGAMEKIT_LOG_COMPILE_TIME_VERBOSITY=All");
+            PublicDefinitions.Add("AWSGAMEKIT_NATIVE_LOG_MIN_LEVEL=1");
+        }
+
         PublicIncludePaths.Add(Path.Combine(PluginDirectory, "Libraries/include"));
         if (Target.Platform == UnrealTargetPlatform.IOS)
         {
@@ -18,6 +18,7 @@ DEFINE_LOG_CATEGORY(LogAwsGameKit);
 void FAwsGameKitCoreModule::StartupModule()
 {
   UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitCoreModule::StartupModule()"));
+  FGameKitLogging::Startup();
 #if PLATFORM_IOS
   ::GameKitInitializeAwsSdk(FGameKitLogging::LogCallBack);
 #endif
@@ -29,6 +30,7 @@ void FAwsGameKitCoreModule::ShutdownModule()
 #if PLATFORM_IOS
   ::GameKitShutdownAwsSdk(FGameKitLogging::LogCallBack);
 #endif
+  FGameKitLogging::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
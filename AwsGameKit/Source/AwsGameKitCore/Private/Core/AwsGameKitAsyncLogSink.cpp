@@ -0,0 +1,259 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/AwsGameKitAsyncLogSink.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/Logging.h"
+
+// Unreal
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/CString.h"
+
+TAutoConsoleVariable<int32> CVarGameKitLogAsyncRateLimitVerbose(
+    TEXT("GameKit.Log.Async.RateLimit.Verbose"),
+    200,
+    TEXT("Maximum number of Verbose messages per second queued by the asynchronous GameKit log. Further messages in the same second are dropped.\n")
+    TEXT(" <=0: no limit\n"));
+
+TAutoConsoleVariable<int32> CVarGameKitLogAsyncRateLimitInfo(
+    TEXT("GameKit.Log.Async.RateLimit.Info"),
+    200,
+    TEXT("Maximum number of Info messages per second queued by the asynchronous GameKit log. Further messages in the same second are dropped.\n")
+    TEXT(" <=0: no limit\n"));
+
+TAutoConsoleVariable<int32> CVarGameKitLogAsyncRateLimitWarning(
+    TEXT("GameKit.Log.Async.RateLimit.Warning"),
+    100,
+    TEXT("Maximum number of Warning messages per second queued by the asynchronous GameKit log. Further messages in the same second are dropped.\n")
+    TEXT(" <=0: no limit\n"));
+
+TAutoConsoleVariable<int32> CVarGameKitLogAsyncRateLimitError(
+    TEXT("GameKit.Log.Async.RateLimit.Error"),
+    0,
+    TEXT("Maximum number of Error messages per second queued by the asynchronous GameKit log. Further messages in the same second are dropped.\n")
+    TEXT(" <=0: no limit\n"));
+
+namespace
+{
+    // How long the background thread sleeps when there is nothing to log, and how often it reports dropped messages
+    constexpr uint32 IdleWaitMs = 100;
+    constexpr double ReportIntervalSeconds = 1.0;
+
+    constexpr char TruncatedSuffix[] = "...";
+}
+
+FAwsGameKitAsyncLogSink::FAwsGameKitAsyncLogSink(uint32 Capacity)
+{
+    const uint32 capacity = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(Capacity, 2));
+    mask = capacity - 1;
+
+    slots = MakeUnique<FSlot[]>(capacity);
+    for (uint32 i = 0; i < capacity; ++i)
+    {
+        slots[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+
+    wakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FAwsGameKitAsyncLogSink::~FAwsGameKitAsyncLogSink()
+{
+    StopAndFlush();
+    FPlatformProcess::ReturnSynchEventToPool(wakeEvent);
+    wakeEvent = nullptr;
+}
+
+bool FAwsGameKitAsyncLogSink::Start()
+{
+    lastReportTime = FPlatformTime::Seconds();
+    thread = FRunnableThread::Create(this, TEXT("AwsGameKitLog"), 0, TPri_BelowNormal);
+    return thread != nullptr;
+}
+
+void FAwsGameKitAsyncLogSink::StopAndFlush()
+{
+    if (thread == nullptr)
+    {
+        return;
+    }
+
+    // Run() drains the buffer before returning
+    thread->Kill(true);
+    delete thread;
+    thread = nullptr;
+}
+
+bool FAwsGameKitAsyncLogSink::Enqueue(unsigned int Level, const char* Message)
+{
+    if (isRateLimited(Level))
+    {
+        ++rateLimited;
+        return false;
+    }
+
+    // Bounded multi-producer queue: claim a slot by moving enqueuePosition past it, publish it through its sequence number
+    FSlot* slot = nullptr;
+    uint32 position = enqueuePosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        slot = &slots[position & mask];
+        const uint32 sequence = slot->Sequence.load(std::memory_order_acquire);
+        const int32 difference = static_cast<int32>(sequence - position);
+        if (difference == 0)
+        {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Full, the background thread has not logged this slot yet
+            ++dropped;
+            return false;
+        }
+        else
+        {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->Level = Level;
+    const int32 length = FCStringAnsi::Strlen(Message);
+    if (length < MaxMessageLength)
+    {
+        FMemory::Memcpy(slot->Message, Message, length + 1);
+    }
+    else
+    {
+        const int32 keep = MaxMessageLength - sizeof(TruncatedSuffix);
+        FMemory::Memcpy(slot->Message, Message, keep);
+        FMemory::Memcpy(slot->Message + keep, TruncatedSuffix, sizeof(TruncatedSuffix));
+    }
+    // Sequentially consistent, paired with the background thread setting bWaiting before it checks for work one last time
+    slot->Sequence.store(position + 1);
+
+    if (bWaiting)
+    {
+        wakeEvent->Trigger();
+    }
+
+    return true;
+}
+
+uint32 FAwsGameKitAsyncLogSink::Run()
+{
+    while (!bStopping)
+    {
+        while (drainOne())
+        {
+        }
+
+        reportDropped();
+
+        // Announce the wait before checking for work once more, so a producer that missed the flag has already published its slot
+        bWaiting = true;
+        if (!drainOne())
+        {
+            wakeEvent->Wait(IdleWaitMs);
+        }
+        bWaiting = false;
+    }
+
+    // Log what was queued before stopping
+    while (drainOne())
+    {
+    }
+    reportDropped();
+
+    return 0;
+}
+
+void FAwsGameKitAsyncLogSink::Stop()
+{
+    bStopping = true;
+    wakeEvent->Trigger();
+}
+
+bool FAwsGameKitAsyncLogSink::isRateLimited(unsigned int level)
+{
+    int32 limit = 0;
+    switch (level)
+    {
+    case 1:
+        limit = CVarGameKitLogAsyncRateLimitVerbose.GetValueOnAnyThread();
+        break;
+    case 2:
+        limit = CVarGameKitLogAsyncRateLimitInfo.GetValueOnAnyThread();
+        break;
+    case 3:
+        limit = CVarGameKitLogAsyncRateLimitWarning.GetValueOnAnyThread();
+        break;
+    case 4:
+        limit = CVarGameKitLogAsyncRateLimitError.GetValueOnAnyThread();
+        break;
+    default:
+        limit = CVarGameKitLogAsyncRateLimitInfo.GetValueOnAnyThread();
+        break;
+    }
+
+    if (limit <= 0)
+    {
+        return false;
+    }
+
+    // Fixed one second windows. Two threads starting a new window at the same time may both reset the count, which only lets a few extra messages through.
+    FRateLimit& rateLimit = rateLimits[level < NumLevels ? level : 0];
+    const int64 currentWindow = static_cast<int64>(FPlatformTime::Seconds());
+    int64 window = rateLimit.WindowStart.load(std::memory_order_relaxed);
+    if (window != currentWindow && rateLimit.WindowStart.compare_exchange_strong(window, currentWindow, std::memory_order_relaxed))
+    {
+        rateLimit.Count.store(0, std::memory_order_relaxed);
+    }
+
+    return rateLimit.Count.fetch_add(1, std::memory_order_relaxed) >= limit;
+}
+
+bool FAwsGameKitAsyncLogSink::drainOne()
+{
+    FSlot& slot = slots[dequeuePosition & mask];
+    const uint32 sequence = slot.Sequence.load();
+    if (static_cast<int32>(sequence - (dequeuePosition + 1)) < 0)
+    {
+        return false;
+    }
+
+    // Log straight from the slot, it is not reused until its sequence number is moved on below
+    FGameKitLogging::WriteMessage(slot.Level, slot.Message);
+
+    slot.Sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+    ++dequeuePosition;
+    return true;
+}
+
+void FAwsGameKitAsyncLogSink::reportDropped()
+{
+    const double now = FPlatformTime::Seconds();
+    if (now - lastReportTime < ReportIntervalSeconds && !bStopping)
+    {
+        return;
+    }
+    lastReportTime = now;
+
+    const uint64 currentDropped = dropped;
+    const uint64 currentRateLimited = rateLimited;
+    if (currentDropped != reportedDropped || currentRateLimited != reportedRateLimited)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitAsyncLogSink: Dropped %llu messages because the log buffer was full and %llu because of rate limits since the last report"),
+            currentDropped - reportedDropped, currentRateLimited - reportedRateLimited);
+        reportedDropped = currentDropped;
+        reportedRateLimited = currentRateLimited;
+    }
+}
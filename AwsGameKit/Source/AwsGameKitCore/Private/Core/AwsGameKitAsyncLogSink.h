@@ -0,0 +1,102 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Unreal
+#include "HAL/Runnable.h"
+#include "Templates/UniquePtr.h"
+
+// Standard Library
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+
+/**
+ * Queues messages from the AWS GameKit libraries so they are logged on a background thread instead of the SDK's request threads.
+ *
+ * Producers copy the message into a fixed-size lock-free ring buffer and return. One background thread drains the buffer
+ * and passes each message to FGameKitLogging::WriteMessage(). When the buffer is full, or a level goes over its rate limit,
+ * the message is dropped and counted instead of blocking the caller. Dropped messages are reported by the background thread.
+ */
+class FAwsGameKitAsyncLogSink : public FRunnable
+{
+public:
+    // Longer messages are truncated
+    static constexpr int32 MaxMessageLength = 1024;
+
+    explicit FAwsGameKitAsyncLogSink(uint32 Capacity);
+    virtual ~FAwsGameKitAsyncLogSink();
+
+    /**
+     * Start the background thread.
+     */
+    bool Start();
+
+    /**
+     * Log whatever is still queued and join the background thread. Nothing may be enqueued once this is called.
+     */
+    void StopAndFlush();
+
+    /**
+     * Queue a message. Never blocks; returns false if the message was dropped.
+     */
+    bool Enqueue(unsigned int Level, const char* Message);
+
+    uint64 GetDroppedCount() const
+    {
+        return dropped;
+    }
+
+    uint64 GetRateLimitedCount() const
+    {
+        return rateLimited;
+    }
+
+    // ------ FRunnable implementation ------
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    struct FSlot
+    {
+        std::atomic<uint32> Sequence { 0 };
+        unsigned int Level = 0;
+        char Message[MaxMessageLength];
+    };
+
+    // Native levels are 1 (verbose) to 4 (error), everything else shares bucket 0
+    static constexpr int32 NumLevels = 5;
+
+    struct FRateLimit
+    {
+        std::atomic<int64> WindowStart { 0 };
+        std::atomic<int32> Count { 0 };
+    };
+
+    bool isRateLimited(unsigned int level);
+    bool drainOne();
+    void reportDropped();
+
+    TUniquePtr<FSlot[]> slots;
+    uint32 mask;
+
+    // Written by producers
+    std::atomic<uint32> enqueuePosition { 0 };
+
+    // Only used by the background thread
+    uint32 dequeuePosition = 0;
+    uint64 reportedDropped = 0;
+    uint64 reportedRateLimited = 0;
+    double lastReportTime = 0.0;
+
+    FRateLimit rateLimits[NumLevels];
+    std::atomic<uint64> dropped { 0 };
+    std::atomic<uint64> rateLimited { 0 };
+
+    std::atomic<bool> bStopping { false };
+    std::atomic<bool> bWaiting { false };
+    FEvent* wakeEvent = nullptr;
+    FRunnableThread* thread = nullptr;
+};
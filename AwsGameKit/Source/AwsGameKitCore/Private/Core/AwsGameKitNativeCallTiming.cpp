@@ -0,0 +1,11 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/AwsGameKitNativeCallTiming.h"
+
+FAwsGameKitNativeCallTiming& FAwsGameKitNativeCallTiming::Get()
+{
+    // Defined here rather than inline so every module shares the same per-thread totals
+    static thread_local FAwsGameKitNativeCallTiming Timing;
+    return Timing;
+}
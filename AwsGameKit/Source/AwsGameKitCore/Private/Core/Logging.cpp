@@ -7,67 +7,254 @@
 
 // GameKit
 #include "AwsGameKitCore.h"
+#include "Core/AwsGameKitAsyncLogSink.h"
 
 // Unreal
 #include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
 #include "Misc/ScopeLock.h"
 
-int32 FGameKitLogging::toggleVerbose = false;
-TArray<IChildLogger*> FGameKitLogging::childLoggers;
+std::atomic<const FGameKitLogging::FChildLoggers*> FGameKitLogging::childLoggers { nullptr };
+std::atomic<uint32> FGameKitLogging::childLoggerEpoch { 0 };
+std::atomic<int32> FGameKitLogging::childLoggerReaders[2] = { { 0 }, { 0 } };
 FCriticalSection FGameKitLogging::childLoggerMutex;
+std::atomic<FAwsGameKitAsyncLogSink*> FGameKitLogging::asyncSink { nullptr };
 
-TAutoConsoleVariable<int32> CVarGameKitToggleVerboseLevel(
+namespace
+{
+    // Cached value of GameKit.ToggleVerboseLevel, written by the console variable system when the variable changes
+    int32 ToggleVerbose = 0;
+
+    thread_local bool bInsideLogCallBack = false;
+}
+
+FAutoConsoleVariableRef CVarGameKitToggleVerboseLevel(
     TEXT("GameKit.ToggleVerboseLevel"),
-    0,
+    ToggleVerbose,
     TEXT("Activates or deactivates logging messages with Verbose level to the Log window.\n")
     TEXT("  0: deactivates\n")
     TEXT(" >0: activates\n"));
 
+TAutoConsoleVariable<int32> CVarGameKitLogAsync(
+    TEXT("GameKit.Log.Async"),
+    0,
+    TEXT("Log the messages of the AWS GameKit libraries on a background thread instead of the thread that produced them.\n")
+    TEXT("Messages are dropped rather than blocking when the buffer is full, see GameKit.Log.Async.BufferSize and GameKit.Log.Async.RateLimit.*.\n")
+    TEXT("Read once when the AwsGameKitCore module starts.\n")
+    TEXT("  0: log on the calling thread\n")
+    TEXT(" >0: log on a background thread\n"),
+    ECVF_ReadOnly);
+
+TAutoConsoleVariable<int32> CVarGameKitLogAsyncBufferSize(
+    TEXT("GameKit.Log.Async.BufferSize"),
+    1024,
+    TEXT("Number of messages the background logging mode can hold before it drops messages. Rounded up to a power of two.\n")
+    TEXT("Read once when the AwsGameKitCore module starts.\n"),
+    ECVF_ReadOnly);
+
 void FGameKitLogging::AttachLogger(IChildLogger* logger)
 {
+    checkf(!bInsideLogCallBack, TEXT("FGameKitLogging::AttachLogger() must not be called from a child logger"));
     FScopeLock scopeLock(&(FGameKitLogging::childLoggerMutex));
     UE_LOG(LogAwsGameKit, Log, TEXT("FGameKitLogging::AttachLogger()"))
-    childLoggers.Add(logger);
+
+    const FChildLoggers* current = childLoggers.load();
+    FChildLoggers* snapshot = current != nullptr ? new FChildLoggers(*current) : new FChildLoggers();
+    snapshot->Add(logger);
+    publishChildLoggers(snapshot);
 }
 
 void FGameKitLogging::DetachLogger(IChildLogger* logger)
 {
+    checkf(!bInsideLogCallBack, TEXT("FGameKitLogging::DetachLogger() must not be called from a child logger"));
     FScopeLock scopeLock(&(FGameKitLogging::childLoggerMutex));
     UE_LOG(LogAwsGameKit, Log, TEXT("FGameKitLogging::DetachLogger()"))
-    childLoggers.Remove(logger);
+
+    const FChildLoggers* current = childLoggers.load();
+    if (current == nullptr || !current->Contains(logger))
+    {
+        return;
+    }
+
+    FChildLoggers* snapshot = new FChildLoggers(*current);
+    snapshot->Remove(logger);
+    if (snapshot->Num() == 0)
+    {
+        delete snapshot;
+        snapshot = nullptr;
+    }
+    publishChildLoggers(snapshot);
+}
+
+void FGameKitLogging::Startup()
+{
+    if (CVarGameKitLogAsync.GetValueOnAnyThread() <= 0)
+    {
+        return;
+    }
+
+    FScopeLock scopeLock(&(FGameKitLogging::childLoggerMutex));
+    if (asyncSink.load() != nullptr)
+    {
+        return;
+    }
+
+    FAwsGameKitAsyncLogSink* sink = new FAwsGameKitAsyncLogSink(CVarGameKitLogAsyncBufferSize.GetValueOnAnyThread());
+    if (!sink->Start())
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FGameKitLogging::Startup(): Could not create the log thread, GameKit messages are logged on the calling thread"));
+        delete sink;
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FGameKitLogging::Startup(): Logging GameKit messages on a background thread"));
+    asyncSink = sink;
+}
+
+void FGameKitLogging::Shutdown()
+{
+    FScopeLock scopeLock(&(FGameKitLogging::childLoggerMutex));
+    FAwsGameKitAsyncLogSink* sink = asyncSink.exchange(nullptr);
+    if (sink == nullptr)
+    {
+        return;
+    }
+
+    // New messages are logged on the calling thread again. Wait for the calls that may still be queuing into the sink.
+    waitForReaders();
+
+    // Logs what is still queued, then joins the log thread
+    delete sink;
+}
+
+uint64 FGameKitLogging::GetDroppedMessageCount()
+{
+    const uint32 epoch = enterRead();
+    const FAwsGameKitAsyncLogSink* sink = asyncSink.load();
+    const uint64 count = sink != nullptr ? sink->GetDroppedCount() + sink->GetRateLimitedCount() : 0;
+    exitRead(epoch);
+    return count;
+}
+
+void FGameKitLogging::publishChildLoggers(const FChildLoggers* snapshot)
+{
+    // Called with childLoggerMutex held
+    const FChildLoggers* previous = childLoggers.exchange(snapshot);
+    waitForReaders();
+    delete previous;
+}
+
+uint32 FGameKitLogging::enterRead()
+{
+    // Enter the current epoch. If a writer moves to the next epoch meanwhile, retry so it knows to wait for this reader.
+    uint32 epoch = childLoggerEpoch.load();
+    ++childLoggerReaders[epoch & 1];
+    while (childLoggerEpoch.load() != epoch)
+    {
+        --childLoggerReaders[epoch & 1];
+        epoch = childLoggerEpoch.load();
+        ++childLoggerReaders[epoch & 1];
+    }
+
+    return epoch;
+}
+
+void FGameKitLogging::exitRead(uint32 epoch)
+{
+    --childLoggerReaders[epoch & 1];
+}
+
+void FGameKitLogging::waitForReaders()
+{
+    // Called with childLoggerMutex held, after replacing a shared pointer.
+    // Readers that start from now on see the new value. Wait for the readers that may still use the previous one.
+    const uint32 previousEpoch = childLoggerEpoch.fetch_add(1);
+    while (childLoggerReaders[previousEpoch & 1] != 0)
+    {
+        FPlatformProcess::Yield();
+    }
 }
 
 void FGameKitLogging::LogCallBack(unsigned int level, const char* message, int size)
 {
+    if (level < AWSGAMEKIT_NATIVE_LOG_MIN_LEVEL)
+    {
+        // Filtered out for this build configuration
+        return;
+    }
+
+    if (level == 1 && !ToggleVerbose && childLoggers.load() == nullptr && LogAwsGameKit.IsSuppressed(ELogVerbosity::Verbose))
+    {
+        // Nobody would see the message
+        return;
+    }
+
+    const uint32 epoch = enterRead();
+    FAwsGameKitAsyncLogSink* sink = asyncSink.load();
+    if (sink != nullptr)
+    {
+        // Never blocks, the message is dropped and counted if it cannot be queued
+        sink->Enqueue(level, message);
+        exitRead(epoch);
+        return;
+    }
+    exitRead(epoch);
+
+    WriteMessage(level, message);
+}
+
+void FGameKitLogging::WriteMessage(unsigned int level, const char* message)
+{
+    const uint32 epoch = enterRead();
+    const FChildLoggers* loggers = childLoggers.load();
+    const bool verbose = level == 1 && !ToggleVerbose;
+    if (verbose && loggers == nullptr && LogAwsGameKit.IsSuppressed(ELogVerbosity::Verbose))
+    {
+        // Nobody would see the message, do not convert it
+        exitRead(epoch);
+        return;
+    }
+
+    // Convert once. Typical messages fit in the conversion's inline buffer and do not allocate.
+    const auto convertedMessage = StringCast<TCHAR>(message);
+    const TCHAR* text = convertedMessage.Get();
+
     switch (level)
     {
     case 1:
-        toggleVerbose = CVarGameKitToggleVerboseLevel.GetValueOnAnyThread();
-        if (toggleVerbose)
+        if (verbose)
         {
-            UE_LOG(LogAwsGameKit, Display, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
+            UE_LOG(LogAwsGameKit, Verbose, TEXT("%s"), text);
         }
         else
         {
-            UE_LOG(LogAwsGameKit, Verbose, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
+            UE_LOG(LogAwsGameKit, Display, TEXT("%s"), text);
         }
         break;
     case 2:
-        UE_LOG(LogAwsGameKit, Display, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
+        UE_LOG(LogAwsGameKit, Display, TEXT("%s"), text);
         break;
     case 3:
-        UE_LOG(LogAwsGameKit, Warning, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
+        UE_LOG(LogAwsGameKit, Warning, TEXT("%s"), text);
         break;
     case 4:
-        UE_LOG(LogAwsGameKit, Error, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
+        UE_LOG(LogAwsGameKit, Error, TEXT("%s"), text);
         break;
     default:
-        UE_LOG(LogAwsGameKit, Display, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
+        UE_LOG(LogAwsGameKit, Display, TEXT("%s"), text);
         break;
     }
 
-    for (auto logger : childLoggers)
+    if (loggers != nullptr)
     {
-        logger->Log(level, FString(message));
+        const FString messageString(text);
+        bInsideLogCallBack = true;
+        for (IChildLogger* logger : *loggers)
+        {
+            logger->Log(level, messageString);
+        }
+        bInsideLogCallBack = false;
     }
+
+    exitRead(epoch);
 }
@@ -8,7 +8,23 @@
 #include "Modules/ModuleInterface.h"
 #include "Modules/ModuleManager.h"
 
-DECLARE_LOG_CATEGORY_EXTERN(LogAwsGameKit, Log, All);
+/**
+ * Most verbose level of LogAwsGameKit compiled into the build. UE_LOG calls on LogAwsGameKit above this level compile to nothing,
+ * so their arguments are neither evaluated nor formatted. Set per build configuration in AwsGameKitCore.Build.cs.
+ */
+#ifndef AWSGAMEKIT_LOG_COMPILE_TIME_VERBOSITY
+#define AWSGAMEKIT_LOG_COMPILE_TIME_VERBOSITY All
+#endif
+
+/**
+ * Lowest level of the messages from the AWS GameKit libraries that are logged: 1 verbose, 2 info, 3 warning, 4 error.
+ * Messages below it are dropped by FGameKitLogging::LogCallBack() before they are converted. Set per build configuration in AwsGameKitCore.Build.cs.
+ */
+#ifndef AWSGAMEKIT_NATIVE_LOG_MIN_LEVEL
+#define AWSGAMEKIT_NATIVE_LOG_MIN_LEVEL 1
+#endif
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAwsGameKit, Log, AWSGAMEKIT_LOG_COMPILE_TIME_VERBOSITY);
 
 class FAwsGameKitCoreModule : public IModuleInterface
 {
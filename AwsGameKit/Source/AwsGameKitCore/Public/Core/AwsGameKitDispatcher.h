@@ -7,6 +7,9 @@
 
 #pragma once
 
+// GameKit
+#include "AwsGameKitNativeCallTiming.h"
+
 /**
  * @brief A pointer to an instance of a class that can receive a callback.
  *
@@ -61,12 +64,14 @@ struct FunctorDispatcher<RetType(Functor::*)(Args...), CbFunc>
 {
     static RetType Dispatch(void* obj, Args... args)
     {
+        FAwsGameKitNativeCallbackScope callbackScope;
         Functor* instance = static_cast<Functor*>(obj);
         return (instance->*CbFunc)(std::forward<Args>(args)...);
     }
 
     static RetType Dispatch(void* obj, Args&&... args)
     {
+        FAwsGameKitNativeCallbackScope callbackScope;
         Functor* instance = static_cast<Functor*>(obj);
         return (instance->*CbFunc)(std::forward<Args>(args)...);
     }
@@ -95,11 +100,13 @@ struct LambdaDispatcher
 {
     static RetType Dispatch(void* func, Args... args)
     {
+        FAwsGameKitNativeCallbackScope callbackScope;
         return (*static_cast<Lambda*>(func)) (std::forward<Args>(args)...);
     }
 
     static RetType Dispatch(void* func, Args&&... args)
     {
+        FAwsGameKitNativeCallbackScope callbackScope;
         return (*static_cast<Lambda*>(func)) (std::forward<Args>(args)...);
     }
 };
@@ -4,6 +4,7 @@
 #pragma once
 
 // GameKit
+#include "AwsGameKitNativeCallTiming.h"
 #include "Logging.h"
 
 // Helper macro to define a Func handle type and instantiate it (set to nullptr).
@@ -26,11 +27,12 @@ __##Func func##Func = nullptr;
 #define CHECK_PLUGIN_FUNC_IS_LOADED(Plugin, FuncPtr, ...) {}
 #endif
 
-// Helper macro to invoke a Func that was declared with DEFINE_FUNC_HANDLE
+// Helper macro to invoke a Func that was declared with DEFINE_FUNC_HANDLE.
+// The time spent in the call is added to FAwsGameKitNativeCallTiming; the scope object lives until the end of the full expression.
 #if PLATFORM_WINDOWS || PLATFORM_MAC
-#define INVOKE_FUNC(Func, ...) (func##Func)(__VA_ARGS__)
+#define INVOKE_FUNC(Func, ...) (FAwsGameKitNativeCallScope(), (func##Func)(__VA_ARGS__))
 #else
-#define INVOKE_FUNC(Func, ...) (::Func)(__VA_ARGS__)
+#define INVOKE_FUNC(Func, ...) (FAwsGameKitNativeCallScope(), (::Func)(__VA_ARGS__))
 #endif
 
 // Helper macro to assign an exported Func (Func must be declared with DEFINE_FUNC_HANDLE)
@@ -0,0 +1,98 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Measures the time spent in the low level GameKit C APIs on the calling thread.
+ */
+
+#pragma once
+
+// Unreal
+#include "HAL/PlatformTime.h"
+
+/**
+ * @brief Time the calling thread has spent in native GameKit calls, and in the callbacks those calls made into Unreal code.
+ *
+ * @details The totals only grow. To measure a piece of work, read them before and after it and subtract.
+ * Native time excluding callbacks is NativeSeconds - CallbackSeconds.
+ */
+struct AWSGAMEKITCORE_API FAwsGameKitNativeCallTiming
+{
+    /**
+     * @brief Total time spent inside INVOKE_FUNC calls, including the callbacks they made.
+     */
+    double NativeSeconds = 0.0;
+
+    /**
+     * @brief Total time spent in FunctorDispatcher and LambdaDispatcher callbacks made while inside a native call.
+     */
+    double CallbackSeconds = 0.0;
+
+    int32 NativeDepth = 0;
+    int32 CallbackDepth = 0;
+
+    /**
+     * @brief The totals of the calling thread.
+     */
+    static FAwsGameKitNativeCallTiming& Get();
+};
+
+/**
+ * @brief Adds its lifetime to FAwsGameKitNativeCallTiming::NativeSeconds. Used by INVOKE_FUNC.
+ */
+class FAwsGameKitNativeCallScope
+{
+public:
+    FAwsGameKitNativeCallScope()
+        : timing(FAwsGameKitNativeCallTiming::Get())
+    {
+        if (timing.NativeDepth++ == 0)
+        {
+            startTime = FPlatformTime::Seconds();
+        }
+    }
+
+    ~FAwsGameKitNativeCallScope()
+    {
+        if (--timing.NativeDepth == 0)
+        {
+            timing.NativeSeconds += FPlatformTime::Seconds() - startTime;
+        }
+    }
+
+private:
+    FAwsGameKitNativeCallTiming& timing;
+    double startTime = 0.0;
+};
+
+/**
+ * @brief Adds its lifetime to FAwsGameKitNativeCallTiming::CallbackSeconds when it runs inside a native call. Used by the dispatchers.
+ */
+class FAwsGameKitNativeCallbackScope
+{
+public:
+    FAwsGameKitNativeCallbackScope()
+        : timing(FAwsGameKitNativeCallTiming::Get())
+    {
+        if (timing.NativeDepth > 0 && timing.CallbackDepth == 0)
+        {
+            ++timing.CallbackDepth;
+            bTiming = true;
+            startTime = FPlatformTime::Seconds();
+        }
+    }
+
+    ~FAwsGameKitNativeCallbackScope()
+    {
+        if (bTiming)
+        {
+            --timing.CallbackDepth;
+            timing.CallbackSeconds += FPlatformTime::Seconds() - startTime;
+        }
+    }
+
+private:
+    FAwsGameKitNativeCallTiming& timing;
+    double startTime = 0.0;
+    bool bTiming = false;
+};
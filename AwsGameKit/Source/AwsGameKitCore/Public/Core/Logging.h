@@ -7,11 +7,16 @@
 #include "Containers/UnrealString.h"
 #include "HAL/CriticalSection.h"
 
+// Standard Library
+#include <atomic>
+
 /**
  * Signature for a callback function the AWS GameKit library can use to log a message.
  */
 typedef void(*FuncLogCallback)(unsigned int level, const char* message, int size);
 
+class FAwsGameKitAsyncLogSink;
+
 /**
  * Interface that defines a Child logger. Use to forward logging messages.
  */
@@ -25,16 +30,67 @@ public:
 
 /**
  * Default implementation for ::FuncFuncLogCallback.
+ *
+ * LogCallBack() is called by the AWS GameKit libraries from any thread. It does not take a lock: the child loggers are
+ * read from an immutable snapshot that AttachLogger() and DetachLogger() replace (read-copy-update).
+ *
+ * When GameKit.Log.Async is set, LogCallBack() only copies the message into a ring buffer and returns. The messages are
+ * written to the log and the child loggers by a background thread, so slow log devices do not stall the SDK's request threads.
  */
 class AWSGAMEKITCORE_API FGameKitLogging
 {
 private:
-    static int32 toggleVerbose;
-    static TArray<IChildLogger*> childLoggers;
+    typedef TArray<IChildLogger*> FChildLoggers;
+
+    // Current snapshot of the child loggers, nullptr when there are none
+    static std::atomic<const FChildLoggers*> childLoggers;
+
+    // Calls currently reading childLoggers or asyncSink, counted per epoch so a writer only waits for the calls that may use the value it replaced
+    static std::atomic<uint32> childLoggerEpoch;
+    static std::atomic<int32> childLoggerReaders[2];
+
+    // Serializes AttachLogger(), DetachLogger(), Startup() and Shutdown()
     static FCriticalSection childLoggerMutex;
 
+    // Set while messages are logged by a background thread, see GameKit.Log.Async
+    static std::atomic<FAwsGameKitAsyncLogSink*> asyncSink;
+
+    static void publishChildLoggers(const FChildLoggers* snapshot);
+    static uint32 enterRead();
+    static void exitRead(uint32 epoch);
+    static void waitForReaders();
+
 public:
+    /**
+     * Forward every message to logger as well. Must not be called from IChildLogger::Log().
+     */
     static void AttachLogger(IChildLogger* logger);
+
+    /**
+     * Stop forwarding messages to logger. Once this returns, logger is not called anymore and can be destroyed.
+     * Must not be called from IChildLogger::Log().
+     */
     static void DetachLogger(IChildLogger* logger);
+
+    /**
+     * Start logging on a background thread if GameKit.Log.Async is set. Called by the AwsGameKitCore module on startup.
+     */
+    static void Startup();
+
+    /**
+     * Log the messages that are still queued and stop the background thread. Called by the AwsGameKitCore module on shutdown.
+     */
+    static void Shutdown();
+
+    /**
+     * Number of messages dropped by the background logging mode, because the buffer was full or a level went over its rate limit.
+     */
+    static uint64 GetDroppedMessageCount();
+
     static void LogCallBack(unsigned int level, const char* message, int size);
+
+    /**
+     * Write a message to the GameKit log category and the child loggers on the calling thread.
+     */
+    static void WriteMessage(unsigned int level, const char* message);
 };
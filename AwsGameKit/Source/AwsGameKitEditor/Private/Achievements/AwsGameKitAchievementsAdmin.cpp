@@ -127,11 +127,9 @@ void AwsGameKitAchievementsAdmin::ListAchievementsForGame(
         return;
     }
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
+    InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Achievements, TEXT("AchievementsAdmin.ListAchievementsForGame"), [=]() {
         AchievementsAdminLibrary achievementsLibrary = GetAchievementsAdminLibrary();
 
-        FGraphEventRef OrderedWorkChain;
-
         auto listAchievementsDispatcher = [&](const char* response)
         {
             UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitAchievements::ListAchievementsForGame(): ListAchievementsDispatcher::Dispatch"));
@@ -141,7 +139,7 @@ void AwsGameKitAchievementsAdmin::ListAchievementsForGame(
 
             if (output.Num() > 0)
             {
-                InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnResultReceivedDelegate, MoveTemp(output));
+                InternalAwsGameKitRunDelegateOnGameThread(OnResultReceivedDelegate, MoveTemp(output));
             }
         };
         typedef LambdaDispatcher<decltype(listAchievementsDispatcher), void, const char*> ListAchievementsDispatcher;
@@ -153,7 +151,7 @@ void AwsGameKitAchievementsAdmin::ListAchievementsForGame(
             &listAchievementsDispatcher,
             ListAchievementsDispatcher::Dispatch));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
@@ -164,54 +162,30 @@ void AwsGameKitAchievementsAdmin::AddAchievementsForGame(const AddAchievementsRe
         return;
     }
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
+    InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Achievements, TEXT("AchievementsAdmin.AddAchievementsForGame"), [=]() {
         AchievementsAdminLibrary achievementsLibrary = GetAchievementsAdminLibrary();
-        FGraphEventRef OrderedWorkChain;
 
         unsigned int numAchievements = AddAchievementsRequest.achievements.Num();
 
         std::vector<GameKit::Achievement> achs;
+        achs.reserve(numAchievements);
 
-        TArray<std::string> idBuffers;
-        idBuffers.SetNum(numAchievements);
-
-        TArray<std::string> titleBuffers;
-        titleBuffers.SetNum(numAchievements);
-
-        TArray<std::string> lockedDescBuffers;
-        lockedDescBuffers.SetNum(numAchievements);
-
-        TArray<std::string> unlockedDescBuffers;
-        unlockedDescBuffers.SetNum(numAchievements);
-
-        TArray<std::string> lockedIconBuffers;
-        lockedIconBuffers.SetNum(numAchievements);
-
-        TArray<std::string> unlockedIconBuffers;
-        unlockedIconBuffers.SetNum(numAchievements);
-
+        FAwsGameKitInternalTempStrings ConvertString;
         for (unsigned int i = 0; i < numAchievements; i++)
         {
-            AdminAchievement targetAchievement = AddAchievementsRequest.achievements[i];
-
-            idBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.achievementId);
-            titleBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.title);
-            lockedDescBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.lockedDescription);
-            unlockedDescBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.unlockedDescription);
-            lockedIconBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.lockedIcon);
-            unlockedIconBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.unlockedIcon);
+            const AdminAchievement& targetAchievement = AddAchievementsRequest.achievements[i];
 
             int32 requiredAmount = targetAchievement.requiredAmount;
             requiredAmount = requiredAmount <= 0 ? 1 : requiredAmount;
 
             GameKit::Achievement a
             {
-                idBuffers[i].c_str(),
-                titleBuffers[i].c_str(),
-                lockedDescBuffers[i].c_str(),
-                unlockedDescBuffers[i].c_str(),
-                lockedIconBuffers[i].c_str(),
-                unlockedIconBuffers[i].c_str(),
+                ConvertString(targetAchievement.achievementId),
+                ConvertString(targetAchievement.title),
+                ConvertString(targetAchievement.lockedDescription),
+                ConvertString(targetAchievement.unlockedDescription),
+                ConvertString(targetAchievement.lockedIcon),
+                ConvertString(targetAchievement.unlockedIcon),
                 (unsigned int)requiredAmount,
                 (unsigned int)targetAchievement.points,
                 (unsigned int)targetAchievement.sortOrder,
@@ -228,7 +202,7 @@ void AwsGameKitAchievementsAdmin::AddAchievementsForGame(const AddAchievementsRe
             achs.size()
             ));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result);
     });
 }
 
@@ -239,31 +213,19 @@ void AwsGameKitAchievementsAdmin::DeleteAchievementsForGame(const DeleteAchievem
         return;
     }
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
+    InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Achievements, TEXT("AchievementsAdmin.DeleteAchievementsForGame"), [=]() {
         AchievementsAdminLibrary achievementsLibrary = GetAchievementsAdminLibrary();
-        FGraphEventRef OrderedWorkChain;
-
-        const unsigned int numAchievements = DeleteAchievementsRequest.achievementIdentifiers.Num();
-
-        TArray<std::string> buffers;
-        buffers.SetNum(numAchievements);
-        TArray<const char*> bufferChrPtrs;
-        bufferChrPtrs.SetNum(numAchievements);
 
-        for (unsigned int i = 0; i < numAchievements; i++)
-        {
-            FString target = DeleteAchievementsRequest.achievementIdentifiers[i];
-            buffers[i] = TCHAR_TO_UTF8(*target);
-            bufferChrPtrs[i] = buffers[i].c_str();
-        }
+        FAwsGameKitInternalUtf8Array achievementIds;
+        achievementIds.Append(DeleteAchievementsRequest.achievementIdentifiers);
 
         IntResult result(achievementsLibrary.AchievementsAdminWrapper->GameKitAdminDeleteAchievements(
             achievementsLibrary.AchievementsInstanceHandle,
-            bufferChrPtrs.GetData(),
-            numAchievements
+            achievementIds.GetData(),
+            achievementIds.Num()
             ));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result);
     });
 }
 
@@ -10,6 +10,7 @@
 #include "AwsGameKitStyleSet.h"
 #include "FeatureResourceManager.h"
 #include "Core/AwsGameKitErrors.h"
+#include "GameSaving/AwsGameKitSaveInfoIndex.h"
 #include "Identity/AwsGameKitIdentity.h"
 #include "Models/AwsGameKitGameSavingModels.h"
 #include "Utils/Blueprints/UAwsGameKitFileUtils.h"
@@ -196,21 +197,20 @@ void AAwsGameKitGameSavingExamples::InitializeGameSavingLibrary(const TFunction<
     // Begin actual initialization:
 
     /*
-     * Find all SaveInfo.json files on the device.
+     * Add all SaveInfo.json files on the device.
      *
      * In this example, the SaveInfo.json files are saved to UAwsGameKitFileUtils::GetFeatureSaveDirectory().
+     * Because they are all in one directory, AddLocalSlotsFromDirectory() can load them from the directory's index in a single read.
+     * If your SaveInfo.json files are spread over several directories, pass their paths to AddLocalSlots() instead.
      *
      * In your own game, you should store each SaveInfo.json file alongside its corresponding save file.
      * This will help other developers and players to understand both files go together.
      */
-    FFilePaths saveInfoFilePaths;
-    const FString searchDirectory = UAwsGameKitFileUtils::GetFeatureSaveDirectory(FeatureType_E::GameStateCloudSaving);
-    const FString fileExtension = AwsGameKitGameSaving::GetSaveInfoFileExtension();
-    UAwsGameKitFileUtils::GetFilesInDirectory(saveInfoFilePaths, searchDirectory, fileExtension);
+    const FString saveInfoDirectory = UAwsGameKitFileUtils::GetFeatureSaveDirectory(FeatureType_E::GameStateCloudSaving);
 
-    // Call AddLocalSlots():
+    // Call AddLocalSlotsFromDirectory():
     const auto ResultDelegate = MakeAwsGameKitDelegate(this, &AAwsGameKitGameSavingExamples::OnAddLocalSlotsComplete);
-    AwsGameKitGameSaving::AddLocalSlots(saveInfoFilePaths, ResultDelegate);
+    AwsGameKitGameSaving::AddLocalSlotsFromDirectory(saveInfoDirectory, ResultDelegate);
 
     // GetAllSlotSyncStatuses() is called in the ResultDelegate for AddLocalSlots()
     // because it should be called *after* AddLocalSlots() has completed.
@@ -991,6 +991,9 @@ void AAwsGameKitGameSavingExamples::OnDeleteGameSaveComplete(const IntResult& re
     {
         const FString saveInfoAbsolutePath = GetSaveInfoFilePath(slotActionResults.ActedOnSlot.SlotName);
         UAwsGameKitFileUtils::DeleteFile(saveInfoAbsolutePath);
+
+        // The SaveInfo.json files were added with AddLocalSlotsFromDirectory(), keep the directory's index in step:
+        FAwsGameKitSaveInfoIndex::Get().Remove(saveInfoAbsolutePath);
     }
 }
 
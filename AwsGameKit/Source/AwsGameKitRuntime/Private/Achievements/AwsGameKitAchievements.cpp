@@ -8,53 +8,58 @@
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimeInternalHelpers.h"
 
-AchievementsLibrary AwsGameKitAchievements::GetAchievementsLibraryFromModule()
+const AchievementsLibrary& AwsGameKitAchievements::GetAchievementsLibraryFromModule()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitAchievements::GetAchievementsLibraryFromModule()"));
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    return runtimeModule->GetAchievementsLibrary();
+    return FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
 }
 
-void AwsGameKitAchievements::ListAchievementsForPlayer(
+FAwsGameKitOperationHandle AwsGameKitAchievements::ListAchievementsForPlayer(
     const FListAchievementsRequest& ListAchievementsRequest,
     TAwsGameKitDelegateParam<const TArray<FAchievement>&> OnResultReceivedDelegate,
     FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
-        AchievementsLibrary achievementsLibrary = GetAchievementsLibraryFromModule();
-
-        FGraphEventRef OrderedWorkChain;
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Achievements, TEXT("Achievements.ListAchievementsForPlayer"), [=]() {
+        const AchievementsLibrary& achievementsLibrary = GetAchievementsLibraryFromModule();
 
         auto listAchievementsDispatcher = [&](const char* response)
         {
             UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitAchievements::ListAchievementsForPlayer(): ListAchievementsDispatcher::Dispatch"));
+            if (InternalAwsGameKitIsOperationAbandoned())
+            {
+                return;
+            }
+
             const FString data = UTF8_TO_TCHAR(response);
             TArray<FAchievement> output;
             AwsGamekitAchievementsResponseProcessor::GetListOfAchievementsFromResponse(output, data);
             if (output.Num() > 0)
             {
-                InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnResultReceivedDelegate, MoveTemp(output));
+                InternalAwsGameKitRunDelegateOnGameThread(OnResultReceivedDelegate, MoveTemp(output));
             }
         };
         typedef LambdaDispatcher<decltype(listAchievementsDispatcher), void, const char*> ListAchievementsDispatcher;
 
         IntResult result(achievementsLibrary.AchievementsWrapper->GameKitListAchievements(achievementsLibrary.AchievementsInstanceHandle, ListAchievementsRequest.PageSize, ListAchievementsRequest.WaitForAllPages, &listAchievementsDispatcher, ListAchievementsDispatcher::Dispatch));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitAchievements::GetAchievementForPlayer(
+FAwsGameKitOperationHandle AwsGameKitAchievements::GetAchievementForPlayer(
     const FGetAchievementRequest& GetAchievementRequest,
     TAwsGameKitDelegateParam<const IntResult&, const FAchievement&> ResultDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
-        AchievementsLibrary achievementsLibrary = GetAchievementsLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Achievements, TEXT("Achievements.GetAchievementForPlayer"), [=]() {
+        const AchievementsLibrary& achievementsLibrary = GetAchievementsLibraryFromModule();
 
         FAchievement ach;
         auto getAchievementDispatcher = [&](const char* response)
         {
+            if (InternalAwsGameKitIsOperationAbandoned())
+            {
+                return;
+            }
+
             FString achievementStr = UTF8_TO_TCHAR(response);
             ach = AwsGamekitAchievementsResponseProcessor::GetAchievementFromJsonResponse(AwsGamekitAchievementsResponseProcessor::UnpackResponseAsJson(achievementStr));
         };
@@ -63,21 +68,25 @@ void AwsGameKitAchievements::GetAchievementForPlayer(
         IntResult result(achievementsLibrary.AchievementsWrapper->GameKitGetAchievement(achievementsLibrary.AchievementsInstanceHandle,
             TCHAR_TO_UTF8(*GetAchievementRequest.AchievementId), &getAchievementDispatcher, GetAchievementDispatcher::Dispatch));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, ach);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, ach);
     });
 }
 
-void AwsGameKitAchievements::UpdateAchievementForPlayer(
+FAwsGameKitOperationHandle AwsGameKitAchievements::UpdateAchievementForPlayer(
     const FUpdateAchievementRequest& UpdateAchievementRequest,
     TAwsGameKitDelegateParam<const IntResult&, const FAchievement&> ResultDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
-        AchievementsLibrary achievementsLibrary = GetAchievementsLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Achievements, TEXT("Achievements.UpdateAchievementForPlayer"), [=]() {
+        const AchievementsLibrary& achievementsLibrary = GetAchievementsLibraryFromModule();
 
         FAchievement ach;
         auto updateAchievementDispatcher = [&](const char* response)
         {
+            if (InternalAwsGameKitIsOperationAbandoned())
+            {
+                return;
+            }
+
             FString achievementStr = UTF8_TO_TCHAR(response);
             ach = AwsGamekitAchievementsResponseProcessor::GetAchievementFromJsonResponse(AwsGamekitAchievementsResponseProcessor::UnpackResponseAsJson(achievementStr));
         };
@@ -87,16 +96,15 @@ void AwsGameKitAchievements::UpdateAchievementForPlayer(
             TCHAR_TO_UTF8(*UpdateAchievementRequest.AchievementId), UpdateAchievementRequest.IncrementBy,
             &updateAchievementDispatcher, UpdateAchievementDispatcher::Dispatch));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, ach);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, ach);
     });
 }
 
-void AwsGameKitAchievements::GetAchievementIconBaseUrl(
+FAwsGameKitOperationHandle AwsGameKitAchievements::GetAchievementIconBaseUrl(
     TAwsGameKitDelegateParam<const IntResult&, const FString&> ResultDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
-        AchievementsLibrary achievementsLibrary = GetAchievementsLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Achievements, TEXT("Achievements.GetAchievementIconBaseUrl"), [=]() {
+        const AchievementsLibrary& achievementsLibrary = GetAchievementsLibraryFromModule();
 
         FString url;
         auto getBaseUrlDispatcher = [&](const char* response)
@@ -107,6 +115,6 @@ void AwsGameKitAchievements::GetAchievementIconBaseUrl(
 
         IntResult result(achievementsLibrary.AchievementsWrapper->GameKitGetAchievementIconsBaseUrl(achievementsLibrary.AchievementsInstanceHandle, &getBaseUrlDispatcher, GetBaseUrlDispatcher::Dispatch));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, url);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, url);
     });
 }
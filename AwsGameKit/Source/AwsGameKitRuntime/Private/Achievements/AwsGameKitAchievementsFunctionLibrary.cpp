@@ -6,6 +6,7 @@
 // GameKit
 #include "AwsGameKitCore.h"
 #include "AwsGameKitRuntime.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
 #include "Core/AwsGameKitErrors.h"
 
 // Unreal
@@ -29,8 +30,7 @@ void UAwsGameKitAchievementsFunctionLibrary::GetAchievementIconsBaseUrl(
     {
         Action->LaunchThreadedWork([State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            AchievementsLibrary achievementsLibrary = runtimeModule->GetAchievementsLibrary();
+            const AchievementsLibrary& achievementsLibrary = FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
 
             auto getUrlDispatcher = [&](const char* response)
             {
@@ -64,14 +64,18 @@ void UAwsGameKitAchievementsFunctionLibrary::ListAchievementsForPlayer(
         Action->LaunchThreadedWork([ListAchievementsRequest, State]
         {
             TArray<FAchievement> CompletedResult;
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            AchievementsLibrary achievementsLibrary = runtimeModule->GetAchievementsLibrary();
+            const AchievementsLibrary& achievementsLibrary = FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
 
             FAwsGameKitOperationResult operationResult;
 
             auto listAchievementsDispatcher = [&](const char* response)
             {
                 UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::ListAchievementsForPlayer(): ListAchievementsDispatcher::Dispatch"));
+                if (InternalAwsGameKitIsOperationAbandoned())
+                {
+                    return;
+                }
+
                 FString data(UTF8_TO_TCHAR(response));
                 TArray<FAchievement> output;
                 AwsGamekitAchievementsResponseProcessor::GetListOfAchievementsFromResponse(output, data);
@@ -113,13 +117,17 @@ void UAwsGameKitAchievementsFunctionLibrary::UpdateAchievementForPlayer(
     {
         Action->LaunchThreadedWork([UpdateAchievementsRequest, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            AchievementsLibrary achievementsLibrary = runtimeModule->GetAchievementsLibrary();
+            const AchievementsLibrary& achievementsLibrary = FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
 
             auto updatedAchievementDispatcher = [&, UpdateAchievementsRequest](const char* response)
             {
-                FString updatedAchievementResponse(UTF8_TO_TCHAR(response));
                 UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::UpdateAchievementForPlayer() GetUrlDispatcher::Dispatch"));
+                if (InternalAwsGameKitIsOperationAbandoned())
+                {
+                    return;
+                }
+
+                FString updatedAchievementResponse(UTF8_TO_TCHAR(response));
                 State->Results = AwsGamekitAchievementsResponseProcessor::GetAchievementFromJsonResponse(AwsGamekitAchievementsResponseProcessor::UnpackResponseAsJson(updatedAchievementResponse));
             };
 
@@ -149,13 +157,17 @@ void UAwsGameKitAchievementsFunctionLibrary::GetAchievementForPlayer(
     {
         Action->LaunchThreadedWork([AchievementId, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            AchievementsLibrary achievementsLibrary = runtimeModule->GetAchievementsLibrary();
+            const AchievementsLibrary& achievementsLibrary = FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
 
             auto getAchievementDispatcher = [&](const char* response)
             {
-                FString achievementResponse(UTF8_TO_TCHAR(response));
                 UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::GetAchievementForPlayer() GetAchievementDispatcher::Dispatch"));
+                if (InternalAwsGameKitIsOperationAbandoned())
+                {
+                    return;
+                }
+
+                FString achievementResponse(UTF8_TO_TCHAR(response));
                 State->Results = AwsGamekitAchievementsResponseProcessor::GetAchievementFromJsonResponse(AwsGamekitAchievementsResponseProcessor::UnpackResponseAsJson(achievementResponse));
             };
 
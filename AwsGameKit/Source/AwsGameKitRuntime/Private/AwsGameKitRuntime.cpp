@@ -5,12 +5,17 @@
 
 // GameKit
 #include "AwsGameKitCore.h"
+#include "Common/AwsGameKitCompletionQueue.h"
+#include "Common/AwsGameKitExecutor.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBuffer.h"
 #if WITH_EDITOR
 #include "AwsGameKitEditor/Public/AwsGameKitEditor.h"
 #endif
 
 // Unreal
 #include "GenericPlatform/GenericPlatformMisc.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/MessageDialog.h"
 
 // Unreal public module dependency
@@ -24,13 +29,56 @@
 
 #define LOCTEXT_NAMESPACE "FAwsGameKitSessionManager"
 
-FCriticalSection FAwsGameKitRuntimeModule::libLoadMutex;
+std::atomic<FAwsGameKitRuntimeModule*> FAwsGameKitRuntimeModule::instance { nullptr };
+
+TAutoConsoleVariable<FString> CVarGameKitStartupPreloadFeatures(
+    TEXT("GameKit.Startup.PreloadFeatures"),
+    TEXT(""),
+    TEXT("Comma separated list of feature libraries to load in parallel on the AWS GameKit worker threads when the AwsGameKitRuntime module starts.\n")
+    TEXT("Valid values are Identity, Achievements, GameStateCloudSaving, UserGameplayData and All.\n")
+    TEXT("Empty (the default) loads each feature library on its first use. Read once on startup, set it in the [SystemSettings] section of DefaultEngine.ini.\n"),
+    ECVF_ReadOnly);
+
+namespace
+{
+    TArray<FeatureType_E> ParsePreloadFeatures(const FString& FeatureList)
+    {
+        TArray<FString> names;
+        FeatureList.ParseIntoArray(names, TEXT(","));
+
+        TArray<FeatureType_E> features;
+        for (FString& name : names)
+        {
+            name.TrimStartAndEndInline();
+            if (name.Equals(TEXT("All"), ESearchCase::IgnoreCase))
+            {
+                features = { FeatureType_E::Identity, FeatureType_E::Achievements, FeatureType_E::GameStateCloudSaving, FeatureType_E::UserGameplayData };
+                break;
+            }
+
+            const int64 value = StaticEnum<FeatureType_E>()->GetValueByNameString(name);
+            if (value == INDEX_NONE)
+            {
+                UE_LOG(LogAwsGameKit, Warning, TEXT("GameKit.Startup.PreloadFeatures: Unknown feature '%s' ignored"), *name);
+                continue;
+            }
+
+            features.AddUnique(static_cast<FeatureType_E>(value));
+        }
+
+        return features;
+    }
+}
 
 void FAwsGameKitRuntimeModule::StartupModule()
 {
     UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::StartupModule()"));
     const bool wrappersInitialized = initializeWrappers();
 
+    FAwsGameKitExecutor::Get().Startup();
+    FAwsGameKitCompletionQueue::Get().Startup();
+    FAwsGameKitUserGameplayDataWriteBuffer::Get().Startup();
+
     // Starts the SessionManager with an empty configuration file.
     // The configuration file can be reloaded by calling AwsGameKitSessionManagerWrapper::ReloadConfigFile()
     sessionManagerLibrary.SessionManagerInstanceHandle = sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerInstanceCreate(nullptr, FGameKitLogging::LogCallBack);
@@ -40,15 +88,37 @@ void FAwsGameKitRuntimeModule::StartupModule()
 #elif UE_BUILD_SHIPPING || !WITH_EDITOR
     ReloadConfigFile(FPaths::LaunchDir());
 #endif
+
+    instance.store(this, std::memory_order_release);
+
+    // Opt-in: take the cost of loading the feature libraries now, in the background, instead of in the first login or save
+    PreloadFeatureLibrariesAsync(ParsePreloadFeatures(CVarGameKitStartupPreloadFeatures.GetValueOnGameThread()));
 }
 
 void FAwsGameKitRuntimeModule::ShutdownModule()
 {
+    // Send Get() back to the module manager, which knows whether this module is still loaded
+    instance.store(nullptr, std::memory_order_release);
+
     // Unload AWS GameKitSession Manager Library
     UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::ShutdownModule()"));
 
     // Calling Shutdown() on this module gives exceptions after the editor is closed.
 
+    FAwsGameKitUserGameplayDataWriteBuffer::Get().Shutdown();
+
+    // Join the worker threads before the feature instances they call into are released
+    FAwsGameKitExecutor::Get().Shutdown();
+    FAwsGameKitCompletionQueue::Get().Shutdown();
+
+    // The worker threads are joined, so nothing is loading a library anymore.
+    // Later calls go back through the locked load path and reload the libraries, as before this module was started.
+    pendingPreloads = 0;
+    identityLibraryLoaded.store(false, std::memory_order_release);
+    achievementsLibraryLoaded.store(false, std::memory_order_release);
+    gameSavingLibraryLoaded.store(false, std::memory_order_release);
+    userGameplayDataLibraryLoaded.store(false, std::memory_order_release);
+
     if (identityLibrary.IdentityWrapper != nullptr)
     {
         UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::ShutdownModule(): Releasing Identity Library"));
@@ -92,6 +162,18 @@ void FAwsGameKitRuntimeModule::ShutdownModule()
     }
 }
 
+FAwsGameKitRuntimeModule& FAwsGameKitRuntimeModule::Get()
+{
+    FAwsGameKitRuntimeModule* runtimeModule = instance.load(std::memory_order_acquire);
+    if (runtimeModule == nullptr)
+    {
+        // Called before StartupModule() completed or after ShutdownModule() started
+        runtimeModule = &FModuleManager::GetModuleChecked<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
+    }
+
+    return *runtimeModule;
+}
+
 bool FAwsGameKitRuntimeModule::AreFeatureSettingsLoaded(FeatureType type) const
 {
     bool loaded = sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerAreSettingsLoaded(sessionManagerLibrary.SessionManagerInstanceHandle, type);
@@ -122,40 +204,142 @@ bool FAwsGameKitRuntimeModule::ReloadConfigFile(const FString& subdirectory) con
         AreFeatureSettingsLoaded(FeatureType::GameStateCloudSaving);
 }
 
-CoreLibrary FAwsGameKitRuntimeModule::GetCoreLibrary()
+const CoreLibrary& FAwsGameKitRuntimeModule::GetCoreLibrary() const
 {
     return coreLibrary;
 }
 
-SessionManagerLibrary FAwsGameKitRuntimeModule::GetSessionManagerLibrary()
+const SessionManagerLibrary& FAwsGameKitRuntimeModule::GetSessionManagerLibrary() const
 {
     return sessionManagerLibrary;
 }
 
-IdentityLibrary FAwsGameKitRuntimeModule::GetIdentityLibrary()
+const IdentityLibrary& FAwsGameKitRuntimeModule::GetIdentityLibrary()
 {
-    loadIdentityLibrary();
+    if (!identityLibraryLoaded.load(std::memory_order_acquire))
+    {
+        loadIdentityLibrary();
+    }
     return identityLibrary;
 }
 
-AchievementsLibrary FAwsGameKitRuntimeModule::GetAchievementsLibrary()
+const AchievementsLibrary& FAwsGameKitRuntimeModule::GetAchievementsLibrary()
 {
-    loadAchievementsLibrary();
+    if (!achievementsLibraryLoaded.load(std::memory_order_acquire))
+    {
+        loadAchievementsLibrary();
+    }
     return achievementsLibrary;
 }
 
-GameSavingLibrary FAwsGameKitRuntimeModule::GetGameSavingLibrary()
+const GameSavingLibrary& FAwsGameKitRuntimeModule::GetGameSavingLibrary()
 {
-    loadGameSavingLibrary();
+    if (!gameSavingLibraryLoaded.load(std::memory_order_acquire))
+    {
+        loadGameSavingLibrary();
+    }
     return gameSavingLibrary;
 }
 
-UserGameplayDataLibrary FAwsGameKitRuntimeModule::GetUserGameplayDataLibrary()
+const UserGameplayDataLibrary& FAwsGameKitRuntimeModule::GetUserGameplayDataLibrary()
 {
-    loadUserGameplayDataLibrary();
+    if (!userGameplayDataLibraryLoaded.load(std::memory_order_acquire))
+    {
+        loadUserGameplayDataLibrary();
+    }
     return userGameplayDataLibrary;
 }
 
+void FAwsGameKitRuntimeModule::PreloadFeatureLibraries()
+{
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::PreloadFeatureLibraries()"));
+    GetIdentityLibrary();
+    GetAchievementsLibrary();
+    GetGameSavingLibrary();
+    GetUserGameplayDataLibrary();
+}
+
+void FAwsGameKitRuntimeModule::PreloadFeatureLibrariesAsync(const TArray<FeatureType_E>& Features)
+{
+    TArray<FeatureType_E> featuresToLoad;
+    for (const FeatureType_E feature : Features)
+    {
+        if (feature != FeatureType_E::Main && feature != FeatureType_E::Authentication)
+        {
+            featuresToLoad.AddUnique(feature);
+        }
+    }
+
+    if (featuresToLoad.Num() == 0)
+    {
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::PreloadFeatureLibrariesAsync(): Loading %d feature libraries"), featuresToLoad.Num());
+    pendingPreloads += featuresToLoad.Num();
+
+    for (const FeatureType_E feature : featuresToLoad)
+    {
+        FAwsGameKitExecutor::Get().Enqueue(feature, [this, feature]()
+        {
+            const double startTime = FPlatformTime::Seconds();
+            loadFeatureLibrary(feature);
+            UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::PreloadFeatureLibrariesAsync(): %s library loaded in %.1f ms"),
+                *StaticEnum<FeatureType_E>()->GetNameStringByValue(static_cast<int64>(feature)), (FPlatformTime::Seconds() - startTime) * 1000.0);
+
+            onPreloadComplete();
+        });
+    }
+}
+
+bool FAwsGameKitRuntimeModule::AreFeatureLibrariesReady() const
+{
+    return pendingPreloads == 0;
+}
+
+FOnAwsGameKitFeatureLibrariesReady& FAwsGameKitRuntimeModule::OnFeatureLibrariesReady()
+{
+    return onFeatureLibrariesReady;
+}
+
+void FAwsGameKitRuntimeModule::loadFeatureLibrary(FeatureType_E feature)
+{
+    switch (feature)
+    {
+    case FeatureType_E::Identity:
+        GetIdentityLibrary();
+        break;
+    case FeatureType_E::Achievements:
+        GetAchievementsLibrary();
+        break;
+    case FeatureType_E::GameStateCloudSaving:
+        GetGameSavingLibrary();
+        break;
+    case FeatureType_E::UserGameplayData:
+        GetUserGameplayDataLibrary();
+        break;
+    default:
+        break;
+    }
+}
+
+void FAwsGameKitRuntimeModule::onPreloadComplete()
+{
+    if (--pendingPreloads > 0)
+    {
+        return;
+    }
+
+    FAwsGameKitCompletionQueue::Get().Enqueue([this]()
+    {
+        // Another batch may have been requested since, it broadcasts when it completes
+        if (AreFeatureLibrariesReady())
+        {
+            onFeatureLibrariesReady.Broadcast();
+        }
+    });
+}
+
 void FAwsGameKitRuntimeModule::SetNetworkChangeDelegate(const FNetworkStatusChangeDelegate& networkStatusChangeDelegate)
 {
     if (networkStatusChangeDelegate.IsBound())
@@ -177,7 +361,12 @@ bool FAwsGameKitRuntimeModule::initializeWrappers()
 
 void FAwsGameKitRuntimeModule::loadIdentityLibrary()
 {
-    FScopeLock scopeLock(&libLoadMutex);
+    FScopeLock scopeLock(&identityLoadMutex);
+    if (identityLibraryLoaded.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
     if (identityLibrary.IdentityWrapper == nullptr)
     {
         identityLibrary.IdentityWrapper = MakeShareable(new AwsGameKitIdentityWrapper());
@@ -185,11 +374,18 @@ void FAwsGameKitRuntimeModule::loadIdentityLibrary()
 
         identityLibrary.IdentityInstanceHandle = identityLibrary.IdentityWrapper->GameKitIdentityInstanceCreateWithSessionManager(GetSessionManagerInstance(), FGameKitLogging::LogCallBack);
     }
+
+    identityLibraryLoaded.store(true, std::memory_order_release);
 }
 
 void FAwsGameKitRuntimeModule::loadAchievementsLibrary()
 {
-    FScopeLock scopeLock(&libLoadMutex);
+    FScopeLock scopeLock(&achievementsLoadMutex);
+    if (achievementsLibraryLoaded.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
     if (achievementsLibrary.AchievementsWrapper == nullptr)
     {
         achievementsLibrary.AchievementsWrapper = MakeShareable(new AwsGameKitAchievementsWrapper());
@@ -197,11 +393,18 @@ void FAwsGameKitRuntimeModule::loadAchievementsLibrary()
 
         achievementsLibrary.AchievementsInstanceHandle = achievementsLibrary.AchievementsWrapper->GameKitAchievementsInstanceCreateWithSessionManager(GetSessionManagerInstance(), FGameKitLogging::LogCallBack);
     }
+
+    achievementsLibraryLoaded.store(true, std::memory_order_release);
 }
 
 void FAwsGameKitRuntimeModule::loadGameSavingLibrary()
 {
-    FScopeLock scopeLock(&libLoadMutex);
+    FScopeLock scopeLock(&gameSavingLoadMutex);
+    if (gameSavingLibraryLoaded.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
     if (gameSavingLibrary.GameSavingWrapper == nullptr)
     {
         gameSavingLibrary.GameSavingWrapper = MakeShareable(new AwsGameKitGameSavingWrapper());
@@ -209,11 +412,18 @@ void FAwsGameKitRuntimeModule::loadGameSavingLibrary()
 
         gameSavingLibrary.GameSavingInstanceHandle = gameSavingLibrary.GameSavingWrapper->GameKitGameSavingInstanceCreateWithSessionManager(GetSessionManagerInstance(), FGameKitLogging::LogCallBack, nullptr, 0, DefaultFileActions());
     }
+
+    gameSavingLibraryLoaded.store(true, std::memory_order_release);
 }
 
 void FAwsGameKitRuntimeModule::loadUserGameplayDataLibrary()
 {
-    FScopeLock scopeLock(&libLoadMutex);
+    FScopeLock scopeLock(&userGameplayDataLoadMutex);
+    if (userGameplayDataLibraryLoaded.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
     if (userGameplayDataLibrary.UserGameplayDataWrapper == nullptr)
     {
         userGameplayDataLibrary.UserGameplayDataWrapper = MakeShareable(new AwsGameKitUserGameplayDataWrapper());
@@ -226,6 +436,8 @@ void FAwsGameKitRuntimeModule::loadUserGameplayDataLibrary()
     {
         userGameplayDataLibrary.UserGameplayDataStateHandler = MakeShareable(new AwsGameKitUserGameplayDataStateHandler());
     }
+
+    userGameplayDataLibraryLoaded.store(true, std::memory_order_release);
 }
 
 void FAwsGameKitRuntimeModule::OnNetworkStatusChange(bool isConnectionOk, const char* connectionClient)
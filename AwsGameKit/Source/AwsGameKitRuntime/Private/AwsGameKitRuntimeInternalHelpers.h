@@ -3,13 +3,28 @@
 
 #pragma once
 
+// GameKit
+#include "Common/AwsGameKitApiStats.h"
+#include "Common/AwsGameKitCompletionQueue.h"
+#include "Common/AwsGameKitExecutor.h"
+#include "Common/AwsGameKitOperationHandle.h"
+#include "Models/AwsGameKitCommonModels.h"
+
+// Unreal
 #include "Async/Async.h"
+#include "Containers/StringConv.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CString.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 
 // FAwsGameKitInternalTempStrings is a helper class meant to be used as a callable object
 // that translates string parameters (char*, TCHAR*, or FString) into an appropriate form
-// for storing in a temporary char* variable, duplicating the value into the heap for as
-// long as the helper object is in scope.
+// for storing in a temporary char* variable, keeping the value alive for as long as the
+// helper object is in scope.
 // 
 // For example, given some FString variables and a GameKit model that looks like this:
 //   struct Model { char* Value; char* Value2; };
@@ -28,6 +43,10 @@
 //   ...
 //   GameKitFunction(modelInstance);
 //
+// Strings are converted straight into an arena: a block inside the helper, then heap blocks
+// that double in size. A typical call allocates nothing, and a returned pointer stays valid
+// when later strings are added.
+//
 class FAwsGameKitInternalTempStrings
 {
 public:
@@ -35,20 +54,22 @@ public:
     {
     }
 
+    FAwsGameKitInternalTempStrings(const FAwsGameKitInternalTempStrings&) = delete;
+    FAwsGameKitInternalTempStrings& operator=(const FAwsGameKitInternalTempStrings&) = delete;
+
     ~FAwsGameKitInternalTempStrings()
     {
-        for (char* Str : OwnedStrings)
+        for (char* OwnedBlock : OwnedBlocks)
         {
-            delete[] Str;
+            delete[] OwnedBlock;
         }
     }
 
     char* Dup(const char* Str)
     {
-        size_t Len = strlen(Str);
-        char* Buffer = new char[Len + 1];
+        const int32 Len = (int32)strlen(Str);
+        char* Buffer = Allocate(Len + 1);
         FPlatformMemory::Memcpy(Buffer, Str, Len + 1);
-        OwnedStrings.Add(Buffer);
         return Buffer;
     }
 
@@ -57,68 +78,293 @@ public:
         return Dup(Str);
     }
 
-    char* operator()(const wchar_t* Str)
+    char* operator()(const TCHAR* Str)
     {
-        return Dup(TCHAR_TO_UTF8(Str));
+        return Convert(Str, FCString::Strlen(Str));
     }
 
     char* operator()(const FString& Str)
     {
-        return Dup(TCHAR_TO_UTF8(*Str));
+        return Convert(*Str, Str.Len());
     }
 
 private:
-    TArray<char*,TInlineAllocator<4>> OwnedStrings;
-};
+    char* Convert(const TCHAR* Str, int32 Len)
+    {
+        const int32 Utf8Len = Len > 0 ? FTCHARToUTF8_Convert::ConvertedLength(Str, Len) : 0;
+        char* Buffer = Allocate(Utf8Len + 1);
+        if (Utf8Len > 0)
+        {
+            FTCHARToUTF8_Convert::Convert((FTCHARToUTF8_Convert::ToType*)Buffer, Utf8Len, Str, Len);
+        }
+        Buffer[Utf8Len] = '\0';
+        return Buffer;
+    }
 
+    char* Allocate(int32 Size)
+    {
+        if (BlockUsed + Size > BlockSize)
+        {
+            BlockSize = FMath::Max(BlockSize * 2, Size);
+            Block = new char[BlockSize];
+            OwnedBlocks.Add(Block);
+            BlockUsed = 0;
+        }
 
-template <typename T>
-inline void InternalAwsGameKitRunLambdaOnWorkThread(T&& Work)
-{
-    Async(EAsyncExecution::Thread, Forward<T>(Work));
-}
+        char* Buffer = Block + BlockUsed;
+        BlockUsed += Size;
+        return Buffer;
+    }
 
+    char InlineBlock[256];
+    char* Block = InlineBlock;
+    int32 BlockSize = sizeof(InlineBlock);
+    int32 BlockUsed = 0;
+    TArray<char*,TInlineAllocator<4>> OwnedBlocks;
+};
 
-class FAwsGameKitInternalMainThreadOrderedTask
+// FAwsGameKitInternalUtf8Array converts a list of strings for GameKit models that take a
+// const char** and a count, such as the keys and values of a User Gameplay Data bundle.
+//
+// Every string is converted into one contiguous buffer and only its offset is recorded, so
+// the buffer may grow while strings are added. GetData() turns the offsets into pointers once
+// all strings are in. Size the buffer with Reserve() first and a list of any length costs two
+// allocations, one for the characters and one for the pointers. Append() does this for an array:
+//   int32 Bytes = 0;
+//   for (const FString& Key : Keys) { Bytes += FAwsGameKitInternalUtf8Array::GetConvertedSize(Key); }
+//   FAwsGameKitInternalUtf8Array ConvertedKeys;
+//   ConvertedKeys.Reserve(Keys.Num(), Bytes);
+//   for (const FString& Key : Keys) { ConvertedKeys.Add(Key); }
+//   Model modelInstance = { ConvertedKeys.GetData(), size_t(ConvertedKeys.Num()) };
+//
+class FAwsGameKitInternalUtf8Array
 {
 public:
-    FAwsGameKitInternalMainThreadOrderedTask(TUniqueFunction<void()>&& InFunction) : Function(MoveTemp(InFunction)) {}
-    void DoTask(ENamedThreads::Type, const FGraphEventRef&) { Function(); }
-    ENamedThreads::Type GetDesiredThread() { return ENamedThreads::GameThread; }
-    static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
-    TStatId GetStatId() const { return GET_STATID(STAT_TaskGraph_OtherTasks); }
+    // Bytes Add() uses for Str, including its terminator
+    static int32 GetConvertedSize(const FString& Str)
+    {
+        return (Str.Len() > 0 ? FTCHARToUTF8_Convert::ConvertedLength(*Str, Str.Len()) : 0) + 1;
+    }
+
+    void Reserve(int32 NumStrings, int32 NumBytes)
+    {
+        Offsets.Reserve(NumStrings);
+        Buffer.Reserve(NumBytes);
+    }
+
+    void Add(const FString& Str)
+    {
+        const int32 Offset = Buffer.Num();
+        const int32 Utf8Len = GetConvertedSize(Str) - 1;
+        Buffer.AddUninitialized(Utf8Len + 1);
+        if (Utf8Len > 0)
+        {
+            FTCHARToUTF8_Convert::Convert((FTCHARToUTF8_Convert::ToType*)Buffer.GetData() + Offset, Utf8Len, *Str, Str.Len());
+        }
+        Buffer[Offset + Utf8Len] = '\0';
+        Offsets.Add(Offset);
+    }
+
+    // Adds every string of Strings, sizing the buffer for all of them first
+    void Append(const TArray<FString>& Strings)
+    {
+        int32 NumBytes = Buffer.Num();
+        for (const FString& Str : Strings)
+        {
+            NumBytes += GetConvertedSize(Str);
+        }
+
+        Reserve(Offsets.Num() + Strings.Num(), NumBytes);
+        for (const FString& Str : Strings)
+        {
+            Add(Str);
+        }
+    }
+
+    int32 Num() const
+    {
+        return Offsets.Num();
+    }
+
+    // The pointers are valid until the next call to Add()
+    const char** GetData()
+    {
+        Pointers.SetNumUninitialized(Offsets.Num());
+        for (int32 i = 0; i < Offsets.Num(); ++i)
+        {
+            Pointers[i] = Buffer.GetData() + Offsets[i];
+        }
+        return Pointers.GetData();
+    }
+
 private:
-    TUniqueFunction<void()> Function;
+    TArray<char> Buffer;
+    TArray<int32> Offsets;
+    TArray<const char*> Pointers;
 };
 
-template <typename DelegateType, typename ParamType>
-inline void InternalAwsGameKitRunDelegateOnGameThread(FGraphEventRef& OrderedWorkChain, const DelegateType& Delegate, ParamType&& Param)
+
+// Runs the blocking part of a feature call on the shared GameKit executor.
+// Calls are limited per feature, see FAwsGameKitExecutor.
+// While Work runs, FAwsGameKitOperationState::GetCurrent() returns the state behind the returned handle.
+// ApiName must be a string literal, such as TEXT("Identity.Login"); it names the call in FAwsGameKitApiStats and Unreal Insights.
+template <typename T>
+inline FAwsGameKitOperationHandle InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E Feature, const TCHAR* ApiName, T&& Work)
+{
+    FAwsGameKitOperationStateRef Operation = MakeShared<FAwsGameKitOperationState, ESPMode::ThreadSafe>();
+    Operation->SetApiName(ApiName);
+
+    const double enqueueTime = FPlatformTime::Seconds();
+    FAwsGameKitExecutor::Get().Enqueue(Feature, [Operation, ApiName, enqueueTime, Work = Forward<T>(Work)]() mutable
+    {
+        FAwsGameKitApiStats::Get().Record(ApiName, EAwsGameKitApiPhase::QueueWait, FPlatformTime::Seconds() - enqueueTime);
+
+        // Nobody is waiting for the result anymore, skip the native call entirely
+        if (Operation->IsAbandoned())
+        {
+            return;
+        }
+
+        TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(ApiName);
+        FAwsGameKitOperationState::FScope OperationScope(&Operation.Get());
+        FAwsGameKitApiScope ApiScope(ApiName);
+        Work();
+    });
+    return FAwsGameKitOperationHandle(Operation);
+}
+
+// True when the call whose work is running on this thread was cancelled or has expired.
+// Dispatchers check this before converting native results into Unreal types.
+inline bool InternalAwsGameKitIsOperationAbandoned()
+{
+    const FAwsGameKitOperationState* Operation = FAwsGameKitOperationState::GetCurrent();
+    return Operation != nullptr && Operation->IsAbandoned();
+}
+
+// Runs Work on the calling thread and on up to NumWorkers - 1 more workers in the executor lane of Feature, and returns once
+// every copy of Work that started has returned. Meant for calls that split their work into items: Work takes the next item
+// from a shared counter until none are left.
+// The extra workers count against the lane's concurrency limit like any other call. A worker that only gets a slot after the
+// calling thread ran out of items returns without running Work, so the calling thread never waits for a slot in its own lane.
+// The workers adopt the current call, so cancelling it stops them too, and each worker is recorded under the call's API name.
+template <typename T>
+inline void InternalAwsGameKitRunOnWorkers(FeatureType_E Feature, int32 NumWorkers, T& Work)
 {
-    TUniqueFunction<void()> Function([Delegate, Param = Forward<ParamType>(Param)]{ Delegate.ExecuteIfBound(Param); });
-    if (OrderedWorkChain && !OrderedWorkChain->IsComplete())
+    struct FWorkerGroup
+    {
+        FCriticalSection Mutex;
+        int32 Running = 0;
+        bool bClosed = false;
+        FEvent* Done = FPlatformProcess::GetSynchEventFromPool(true);
+
+        ~FWorkerGroup()
+        {
+            FPlatformProcess::ReturnSynchEventToPool(Done);
+        }
+    };
+
+    // Workers that start after this function returned still reach the group, so it is shared with them
+    TSharedRef<FWorkerGroup, ESPMode::ThreadSafe> Group = MakeShared<FWorkerGroup, ESPMode::ThreadSafe>();
+    FAwsGameKitOperationState* Operation = FAwsGameKitOperationState::GetCurrent();
+    TSharedPtr<FAwsGameKitOperationState, ESPMode::ThreadSafe> OperationPtr;
+    if (Operation != nullptr)
     {
-        FGraphEventArray Prereqs;
-        Prereqs.Add(MoveTemp(OrderedWorkChain));
-        OrderedWorkChain = TGraphTask<FAwsGameKitInternalMainThreadOrderedTask>::CreateTask(&Prereqs).ConstructAndDispatchWhenReady(MoveTemp(Function));
+        OperationPtr = Operation->AsShared();
     }
-    else
+
+    for (int32 i = 1; i < NumWorkers; ++i)
     {
-        OrderedWorkChain = TGraphTask<FAwsGameKitInternalMainThreadOrderedTask>::CreateTask().ConstructAndDispatchWhenReady(MoveTemp(Function));
+        const double enqueueTime = FPlatformTime::Seconds();
+        FAwsGameKitExecutor::Get().Enqueue(Feature, [Group, OperationPtr, enqueueTime, &Work]()
+        {
+            {
+                FScopeLock ScopeLock(&Group->Mutex);
+                if (Group->bClosed)
+                {
+                    return;
+                }
+                ++Group->Running;
+            }
+
+            {
+                FAwsGameKitOperationState::FScope OperationScope(OperationPtr.Get());
+                const TCHAR* ApiName = OperationPtr.IsValid() ? OperationPtr->GetApiName() : nullptr;
+                if (ApiName != nullptr)
+                {
+                    FAwsGameKitApiStats::Get().Record(ApiName, EAwsGameKitApiPhase::QueueWait, FPlatformTime::Seconds() - enqueueTime);
+                    FAwsGameKitApiScope ApiScope(ApiName);
+                    Work();
+                }
+                else
+                {
+                    Work();
+                }
+            }
+
+            FScopeLock ScopeLock(&Group->Mutex);
+            if (--Group->Running == 0 && Group->bClosed)
+            {
+                Group->Done->Trigger();
+            }
+        });
+    }
+
+    Work();
+
+    bool bWait = false;
+    {
+        FScopeLock ScopeLock(&Group->Mutex);
+        Group->bClosed = true;
+        bWait = Group->Running > 0;
+    }
+
+    if (bWait)
+    {
+        Group->Done->Wait();
     }
 }
 
-template <typename DelegateType, typename Param1Type, typename Param2Type>
-inline void InternalAwsGameKitRunDelegateOnGameThread(FGraphEventRef& OrderedWorkChain, const DelegateType& Delegate, Param1Type&& Param1, Param2Type&& Param2)
+
+// Queues Function for delivery on the game thread by the GameKit completion queue.
+// Completions queued from one call's work are delivered in order.
+// Nothing is queued, and nothing runs, once the current call has been cancelled or has expired.
+inline void InternalAwsGameKitRunOnGameThread(TUniqueFunction<void()>&& Function)
 {
-    TUniqueFunction<void()> Function([Delegate, Param1 = Forward<Param1Type>(Param1), Param2 = Forward<Param2Type>(Param2)]{ Delegate.ExecuteIfBound(Param1, Param2); });
-    if (OrderedWorkChain && !OrderedWorkChain->IsComplete())
+    FAwsGameKitOperationState* Operation = FAwsGameKitOperationState::GetCurrent();
+    if (Operation != nullptr && Operation->IsAbandoned())
     {
-        FGraphEventArray Prereqs;
-        Prereqs.Add(MoveTemp(OrderedWorkChain));
-        OrderedWorkChain = TGraphTask<FAwsGameKitInternalMainThreadOrderedTask>::CreateTask(&Prereqs).ConstructAndDispatchWhenReady(MoveTemp(Function));
+        return;
     }
-    else
+
+    TSharedPtr<FAwsGameKitOperationState, ESPMode::ThreadSafe> OperationPtr;
+    if (Operation != nullptr)
     {
-        OrderedWorkChain = TGraphTask<FAwsGameKitInternalMainThreadOrderedTask>::CreateTask().ConstructAndDispatchWhenReady(MoveTemp(Function));
+        OperationPtr = Operation->AsShared();
     }
+
+    const double postTime = FPlatformTime::Seconds();
+    FAwsGameKitCompletionQueue::Get().Enqueue([OperationPtr, postTime, Function = MoveTemp(Function)]
+    {
+        if (!OperationPtr.IsValid() || !OperationPtr->IsAbandoned())
+        {
+            if (OperationPtr.IsValid() && OperationPtr->GetApiName() != nullptr)
+            {
+                FAwsGameKitApiStats::Get().Record(OperationPtr->GetApiName(), EAwsGameKitApiPhase::GameThreadDispatch, FPlatformTime::Seconds() - postTime);
+            }
+
+            Function();
+        }
+    });
+}
+
+template <typename DelegateType, typename ParamType>
+inline void InternalAwsGameKitRunDelegateOnGameThread(const DelegateType& Delegate, ParamType&& Param)
+{
+    InternalAwsGameKitRunOnGameThread([Delegate, Param = Forward<ParamType>(Param)]{ Delegate.ExecuteIfBound(Param); });
+}
+
+template <typename DelegateType, typename Param1Type, typename Param2Type>
+inline void InternalAwsGameKitRunDelegateOnGameThread(const DelegateType& Delegate, Param1Type&& Param1, Param2Type&& Param2)
+{
+    InternalAwsGameKitRunOnGameThread([Delegate, Param1 = Forward<Param1Type>(Param1), Param2 = Forward<Param2Type>(Param2)]{ Delegate.ExecuteIfBound(Param1, Param2); });
 }
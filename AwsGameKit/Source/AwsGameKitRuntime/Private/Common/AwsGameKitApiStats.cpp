@@ -0,0 +1,167 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitApiStats.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_STAT(STAT_AwsGameKitApiCalls);
+DEFINE_STAT(STAT_AwsGameKitApiQueueWait);
+DEFINE_STAT(STAT_AwsGameKitApiNativeCall);
+DEFINE_STAT(STAT_AwsGameKitApiMarshalling);
+DEFINE_STAT(STAT_AwsGameKitApiGameThreadDispatch);
+
+FAutoConsoleCommand CGameKitStats(
+    TEXT("GameKit.Stats"),
+    TEXT("Logs p50/p95/p99 latency of every AWS GameKit API, split into queue wait, native call, marshalling and game thread dispatch.\n")
+    TEXT("GameKit.Stats reset: clears the collected samples."),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+        {
+            FAwsGameKitApiStats::Get().Reset();
+            return;
+        }
+
+        FAwsGameKitApiStats::Get().DumpStats();
+    }));
+
+namespace
+{
+    const TCHAR* GetPhaseName(int32 Phase)
+    {
+        switch (static_cast<EAwsGameKitApiPhase>(Phase))
+        {
+        case EAwsGameKitApiPhase::QueueWait:
+            return TEXT("QueueWait");
+        case EAwsGameKitApiPhase::NativeCall:
+            return TEXT("NativeCall");
+        case EAwsGameKitApiPhase::Marshalling:
+            return TEXT("Marshalling");
+        case EAwsGameKitApiPhase::GameThreadDispatch:
+            return TEXT("GameThreadDispatch");
+        default:
+            return TEXT("Unknown");
+        }
+    }
+
+    double GetPercentile(const TArray<float>& SortedSamples, double Percentile)
+    {
+        if (SortedSamples.Num() == 0)
+        {
+            return 0.0;
+        }
+
+        const int32 index = FMath::Clamp(FMath::CeilToInt(Percentile * SortedSamples.Num()) - 1, 0, SortedSamples.Num() - 1);
+        return SortedSamples[index];
+    }
+}
+
+FAwsGameKitApiStats& FAwsGameKitApiStats::Get()
+{
+    static FAwsGameKitApiStats ApiStats;
+    return ApiStats;
+}
+
+void FAwsGameKitApiStats::Record(const TCHAR* ApiName, EAwsGameKitApiPhase Phase, double Seconds)
+{
+    const double milliseconds = Seconds * 1000.0;
+    switch (Phase)
+    {
+    case EAwsGameKitApiPhase::QueueWait:
+        INC_FLOAT_STAT_BY(STAT_AwsGameKitApiQueueWait, milliseconds);
+        break;
+    case EAwsGameKitApiPhase::NativeCall:
+        INC_FLOAT_STAT_BY(STAT_AwsGameKitApiNativeCall, milliseconds);
+        break;
+    case EAwsGameKitApiPhase::Marshalling:
+        INC_FLOAT_STAT_BY(STAT_AwsGameKitApiMarshalling, milliseconds);
+        break;
+    case EAwsGameKitApiPhase::GameThreadDispatch:
+        INC_FLOAT_STAT_BY(STAT_AwsGameKitApiGameThreadDispatch, milliseconds);
+        break;
+    default:
+        break;
+    }
+
+    const FName apiName(ApiName);
+
+    FScopeLock scopeLock(&mutex);
+    FPhaseSamples& samples = apis.FindOrAdd(apiName).Phases[(int32)Phase];
+    if (samples.Window.Num() < WindowSize)
+    {
+        samples.Window.Add(milliseconds);
+    }
+    else
+    {
+        samples.Window[samples.NextSample] = milliseconds;
+        samples.NextSample = (samples.NextSample + 1) % WindowSize;
+    }
+
+    ++samples.Count;
+    samples.TotalSeconds += Seconds;
+    samples.MaxSeconds = FMath::Max(samples.MaxSeconds, Seconds);
+}
+
+void FAwsGameKitApiStats::DumpStats() const
+{
+    TMap<FName, FApiSamples> apisCopy;
+    {
+        FScopeLock scopeLock(&mutex);
+        apisCopy = apis;
+    }
+
+    apisCopy.KeySort(FNameLexicalLess());
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("AWS GameKit API latency (ms), last %d samples per phase for percentiles:"), WindowSize);
+    for (TPair<FName, FApiSamples>& api : apisCopy)
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("  %s"), *api.Key.ToString());
+        for (int32 phase = 0; phase < (int32)EAwsGameKitApiPhase::Num; ++phase)
+        {
+            FPhaseSamples& samples = api.Value.Phases[phase];
+            if (samples.Count == 0)
+            {
+                continue;
+            }
+
+            samples.Window.Sort();
+            UE_LOG(LogAwsGameKit, Display, TEXT("    %-20s count=%llu avg=%.2f p50=%.2f p95=%.2f p99=%.2f max=%.2f"),
+                GetPhaseName(phase), samples.Count, samples.TotalSeconds * 1000.0 / samples.Count,
+                GetPercentile(samples.Window, 0.50), GetPercentile(samples.Window, 0.95), GetPercentile(samples.Window, 0.99),
+                samples.MaxSeconds * 1000.0);
+        }
+    }
+}
+
+void FAwsGameKitApiStats::Reset()
+{
+    FScopeLock scopeLock(&mutex);
+    apis.Empty();
+}
+
+FAwsGameKitApiScope::FAwsGameKitApiScope(const TCHAR* InApiName)
+    : apiName(InApiName)
+{
+    INC_DWORD_STAT(STAT_AwsGameKitApiCalls);
+
+    const FAwsGameKitNativeCallTiming& timing = FAwsGameKitNativeCallTiming::Get();
+    startNativeSeconds = timing.NativeSeconds;
+    startCallbackSeconds = timing.CallbackSeconds;
+    startTime = FPlatformTime::Seconds();
+}
+
+FAwsGameKitApiScope::~FAwsGameKitApiScope()
+{
+    const double elapsed = FPlatformTime::Seconds() - startTime;
+    const FAwsGameKitNativeCallTiming& timing = FAwsGameKitNativeCallTiming::Get();
+    const double native = (timing.NativeSeconds - startNativeSeconds) - (timing.CallbackSeconds - startCallbackSeconds);
+
+    FAwsGameKitApiStats::Get().Record(apiName, EAwsGameKitApiPhase::NativeCall, native);
+    FAwsGameKitApiStats::Get().Record(apiName, EAwsGameKitApiPhase::Marshalling, FMath::Max(0.0, elapsed - native));
+}
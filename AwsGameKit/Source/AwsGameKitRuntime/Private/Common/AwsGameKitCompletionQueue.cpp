@@ -0,0 +1,103 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitCompletionQueue.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+
+// Unreal
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_STAT(STAT_AwsGameKitCompletionQueueDepth);
+DEFINE_STAT(STAT_AwsGameKitCompletionsDelivered);
+
+TAutoConsoleVariable<float> CVarGameKitCompletionFrameBudgetMs(
+    TEXT("GameKit.Completion.FrameBudgetMs"),
+    2.0f,
+    TEXT("Maximum time in milliseconds spent per frame delivering AWS GameKit results to their delegates on the game thread.\n")
+    TEXT("Results that do not fit in the budget are delivered on the next frame. At least one result is delivered per frame.\n")
+    TEXT(" <=0: no limit, every pending result is delivered in the same frame\n"));
+
+FAwsGameKitCompletionQueue& FAwsGameKitCompletionQueue::Get()
+{
+    static FAwsGameKitCompletionQueue CompletionQueue;
+    return CompletionQueue;
+}
+
+void FAwsGameKitCompletionQueue::Startup()
+{
+    check(IsInGameThread());
+    if (bRunning)
+    {
+        return;
+    }
+
+    tickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitCompletionQueue::Tick));
+    bRunning = true;
+}
+
+void FAwsGameKitCompletionQueue::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bRunning)
+    {
+        return;
+    }
+
+    bRunning = false;
+    FTSTicker::GetCoreTicker().RemoveTicker(tickerHandle);
+    tickerHandle.Reset();
+
+    queue.Empty();
+    queueDepth = 0;
+    SET_DWORD_STAT(STAT_AwsGameKitCompletionQueueDepth, 0);
+}
+
+void FAwsGameKitCompletionQueue::Enqueue(TUniqueFunction<void()>&& Completion)
+{
+    if (!bRunning)
+    {
+        AsyncTask(ENamedThreads::GameThread, MoveTemp(Completion));
+        return;
+    }
+
+    queue.Enqueue(MoveTemp(Completion));
+    SET_DWORD_STAT(STAT_AwsGameKitCompletionQueueDepth, ++queueDepth);
+}
+
+int32 FAwsGameKitCompletionQueue::Drain(double BudgetSeconds)
+{
+    check(IsInGameThread());
+
+    const double endTime = FPlatformTime::Seconds() + BudgetSeconds;
+    int32 delivered = 0;
+
+    TUniqueFunction<void()> completion;
+    while (queue.Dequeue(completion))
+    {
+        --queueDepth;
+        completion();
+        completion.Reset();
+        ++delivered;
+
+        if (BudgetSeconds > 0.0 && FPlatformTime::Seconds() >= endTime)
+        {
+            break;
+        }
+    }
+
+    SET_DWORD_STAT(STAT_AwsGameKitCompletionQueueDepth, queueDepth);
+    INC_DWORD_STAT_BY(STAT_AwsGameKitCompletionsDelivered, delivered);
+    return delivered;
+}
+
+bool FAwsGameKitCompletionQueue::Tick(float DeltaTime)
+{
+    Drain(CVarGameKitCompletionFrameBudgetMs.GetValueOnGameThread() / 1000.0);
+
+    // Keep ticking
+    return true;
+}
@@ -0,0 +1,270 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitExecutor.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+
+// Unreal
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_STAT(STAT_AwsGameKitExecutorQueueDepth);
+DEFINE_STAT(STAT_AwsGameKitLatentActionQueueDepth);
+DEFINE_STAT(STAT_AwsGameKitLatentActionWaitTime);
+
+TAutoConsoleVariable<int32> CVarGameKitExecutorNumThreads(
+    TEXT("GameKit.Executor.NumThreads"),
+    4,
+    TEXT("Number of worker threads used to run AWS GameKit feature calls and Blueprint latent actions.\n")
+    TEXT("Read once when the AwsGameKitRuntime module starts.\n"),
+    ECVF_ReadOnly);
+
+TAutoConsoleVariable<int32> CVarGameKitExecutorMaxConcurrentPerFeature(
+    TEXT("GameKit.Executor.MaxConcurrentPerFeature"),
+    3,
+    TEXT("Maximum number of AWS GameKit calls of a single feature that may run at the same time.\n")
+    TEXT("Further calls of that feature are queued until a running call completes.\n")
+    TEXT(" <=0: no per-feature limit, only the pool size applies\n"));
+
+TAutoConsoleVariable<int32> CVarGameKitExecutorMaxLatentActionsInFlight(
+    TEXT("GameKit.Executor.MaxLatentActionsInFlight"),
+    3,
+    TEXT("Maximum number of AWS GameKit Blueprint latent actions whose threaded work may run at the same time.\n")
+    TEXT("Further latent actions are queued until a running one completes.\n")
+    TEXT(" <=0: no limit, only the pool size applies\n"));
+
+FAutoConsoleCommand CGameKitExecutorDump(
+    TEXT("GameKit.Executor.Dump"),
+    TEXT("Logs the running work, queue depth and wait times of every AWS GameKit executor lane."),
+    FConsoleCommandDelegate::CreateLambda([]() { FAwsGameKitExecutor::Get().DumpStats(); }));
+
+class FAwsGameKitExecutor::FWork : public IQueuedWork
+{
+public:
+    FWork(FAwsGameKitExecutor& InExecutor, int32 InLaneIndex, TUniqueFunction<void()>&& InFunction)
+        : Executor(InExecutor), LaneIndex(InLaneIndex), Function(MoveTemp(InFunction))
+    {}
+
+    virtual void DoThreadedWork() override
+    {
+        Function();
+        Executor.OnWorkComplete(LaneIndex);
+        delete this;
+    }
+
+    virtual void Abandon() override
+    {
+        delete this;
+    }
+
+private:
+    FAwsGameKitExecutor& Executor;
+    int32 LaneIndex;
+    TUniqueFunction<void()> Function;
+};
+
+FAwsGameKitExecutor& FAwsGameKitExecutor::Get()
+{
+    static FAwsGameKitExecutor Executor;
+    return Executor;
+}
+
+void FAwsGameKitExecutor::Startup()
+{
+    FScopeLock scopeLock(&mutex);
+    if (pool != nullptr)
+    {
+        return;
+    }
+
+    const int32 numThreads = FMath::Max(1, CVarGameKitExecutorNumThreads.GetValueOnAnyThread());
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitExecutor::Startup(): Creating %d worker threads"), numThreads);
+
+    // A stack size of 0 uses the platform default, the same as the dedicated threads used before the pool existed.
+    pool = FQueuedThreadPool::Allocate();
+    if (!pool->Create(numThreads, 0, TPri_Normal, TEXT("AwsGameKitWorker")))
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitExecutor::Startup(): Could not create worker threads, GameKit calls will use dedicated threads"));
+        delete pool;
+        pool = nullptr;
+    }
+}
+
+void FAwsGameKitExecutor::Shutdown()
+{
+    FQueuedThreadPool* poolToDestroy = nullptr;
+    {
+        FScopeLock scopeLock(&mutex);
+        poolToDestroy = pool;
+        pool = nullptr;
+
+        for (int32 laneIndex = 0; laneIndex < NumLanes; ++laneIndex)
+        {
+            lanes[laneIndex].PendingWork.Empty();
+            lanes[laneIndex].Stats.Queued = 0;
+            SetQueueDepthStatsLocked(laneIndex);
+        }
+        queueDepth = 0;
+    }
+
+    if (poolToDestroy == nullptr)
+    {
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitExecutor::Shutdown()"));
+
+    // Destroy() abandons work that has not started and waits for running work, which calls back into OnWorkComplete().
+    // The lock must not be held here.
+    poolToDestroy->Destroy();
+    delete poolToDestroy;
+
+    FScopeLock scopeLock(&mutex);
+    for (FLane& lane : lanes)
+    {
+        lane.Stats.Running = 0;
+    }
+}
+
+void FAwsGameKitExecutor::Enqueue(FeatureType_E Feature, TUniqueFunction<void()>&& Work)
+{
+    EnqueueOnLane(GetFeatureLane(Feature), MoveTemp(Work));
+}
+
+void FAwsGameKitExecutor::EnqueueLatentAction(TUniqueFunction<void()>&& Work)
+{
+    EnqueueOnLane(LatentActionLane, MoveTemp(Work));
+}
+
+int32 FAwsGameKitExecutor::GetQueueDepth() const
+{
+    FScopeLock scopeLock(&mutex);
+    return queueDepth;
+}
+
+FAwsGameKitExecutorLaneStats FAwsGameKitExecutor::GetFeatureStats(FeatureType_E Feature) const
+{
+    FScopeLock scopeLock(&mutex);
+    return lanes[GetFeatureLane(Feature)].Stats;
+}
+
+FAwsGameKitExecutorLaneStats FAwsGameKitExecutor::GetLatentActionStats() const
+{
+    FScopeLock scopeLock(&mutex);
+    return lanes[LatentActionLane].Stats;
+}
+
+void FAwsGameKitExecutor::DumpStats() const
+{
+    FAwsGameKitExecutorLaneStats laneStats[NumLanes];
+    bool running;
+    {
+        FScopeLock scopeLock(&mutex);
+        for (int32 laneIndex = 0; laneIndex < NumLanes; ++laneIndex)
+        {
+            laneStats[laneIndex] = lanes[laneIndex].Stats;
+        }
+        running = pool != nullptr;
+    }
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("AWS GameKit executor (%s):"), running ? TEXT("running") : TEXT("stopped"));
+    for (int32 laneIndex = 0; laneIndex < NumLanes; ++laneIndex)
+    {
+        const FAwsGameKitExecutorLaneStats& stats = laneStats[laneIndex];
+        const FString laneName = laneIndex == LatentActionLane
+            ? FString(TEXT("LatentActions"))
+            : StaticEnum<FeatureType_E>()->GetNameStringByValue(laneIndex);
+
+        UE_LOG(LogAwsGameKit, Display, TEXT("  %-20s running=%d queued=%d dispatched=%llu wait(ms): last=%.2f avg=%.2f max=%.2f"),
+            *laneName, stats.Running, stats.Queued, stats.Dispatched,
+            stats.LastWaitSeconds * 1000.0, stats.GetAverageWaitSeconds() * 1000.0, stats.MaxWaitSeconds * 1000.0);
+    }
+}
+
+int32 FAwsGameKitExecutor::GetFeatureLane(FeatureType_E Feature)
+{
+    const int32 laneIndex = static_cast<int32>(Feature);
+    check(laneIndex >= 0 && laneIndex < NumFeatureLanes);
+    return laneIndex;
+}
+
+int32 FAwsGameKitExecutor::GetLaneLimit(int32 LaneIndex)
+{
+    return LaneIndex == LatentActionLane
+        ? CVarGameKitExecutorMaxLatentActionsInFlight.GetValueOnAnyThread()
+        : CVarGameKitExecutorMaxConcurrentPerFeature.GetValueOnAnyThread();
+}
+
+void FAwsGameKitExecutor::EnqueueOnLane(int32 LaneIndex, TUniqueFunction<void()>&& Work)
+{
+    {
+        FScopeLock scopeLock(&mutex);
+        if (pool != nullptr)
+        {
+            FLane& lane = lanes[LaneIndex];
+            const int32 limit = GetLaneLimit(LaneIndex);
+            if (limit > 0 && lane.Stats.Running >= limit)
+            {
+                lane.PendingWork.Enqueue(FPendingWork{ MoveTemp(Work), FPlatformTime::Seconds() });
+                ++lane.Stats.Queued;
+                ++queueDepth;
+                SetQueueDepthStatsLocked(LaneIndex);
+                return;
+            }
+
+            DispatchLocked(LaneIndex, MoveTemp(Work), 0.0);
+            return;
+        }
+    }
+
+    Async(EAsyncExecution::Thread, MoveTemp(Work));
+}
+
+void FAwsGameKitExecutor::DispatchLocked(int32 LaneIndex, TUniqueFunction<void()>&& Work, double WaitSeconds)
+{
+    FAwsGameKitExecutorLaneStats& stats = lanes[LaneIndex].Stats;
+    ++stats.Running;
+    ++stats.Dispatched;
+    stats.LastWaitSeconds = WaitSeconds;
+    stats.MaxWaitSeconds = FMath::Max(stats.MaxWaitSeconds, WaitSeconds);
+    stats.TotalWaitSeconds += WaitSeconds;
+
+    if (LaneIndex == LatentActionLane)
+    {
+        SET_FLOAT_STAT(STAT_AwsGameKitLatentActionWaitTime, WaitSeconds * 1000.0);
+    }
+
+    pool->AddQueuedWork(new FWork(*this, LaneIndex, MoveTemp(Work)));
+}
+
+void FAwsGameKitExecutor::SetQueueDepthStatsLocked(int32 LaneIndex)
+{
+    SET_DWORD_STAT(STAT_AwsGameKitExecutorQueueDepth, queueDepth);
+    if (LaneIndex == LatentActionLane)
+    {
+        SET_DWORD_STAT(STAT_AwsGameKitLatentActionQueueDepth, lanes[LatentActionLane].Stats.Queued);
+    }
+}
+
+void FAwsGameKitExecutor::OnWorkComplete(int32 LaneIndex)
+{
+    FScopeLock scopeLock(&mutex);
+    FLane& lane = lanes[LaneIndex];
+    --lane.Stats.Running;
+
+    // Hand the slot that just freed up to the oldest waiting work of the same lane
+    FPendingWork next;
+    if (pool != nullptr && lane.PendingWork.Dequeue(next))
+    {
+        --lane.Stats.Queued;
+        --queueDepth;
+        SetQueueDepthStatsLocked(LaneIndex);
+
+        DispatchLocked(LaneIndex, MoveTemp(next.Function), FPlatformTime::Seconds() - next.EnqueueTime);
+    }
+}
@@ -0,0 +1,25 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitOperationHandle.h"
+
+namespace
+{
+    thread_local FAwsGameKitOperationState* CurrentOperation = nullptr;
+}
+
+FAwsGameKitOperationState* FAwsGameKitOperationState::GetCurrent()
+{
+    return CurrentOperation;
+}
+
+FAwsGameKitOperationState::FScope::FScope(FAwsGameKitOperationState* Operation)
+    : previous(CurrentOperation)
+{
+    CurrentOperation = Operation;
+}
+
+FAwsGameKitOperationState::FScope::~FScope()
+{
+    CurrentOperation = previous;
+}
@@ -8,74 +8,216 @@
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimeInternalHelpers.h"
 #include "AwsGameKitRuntimePublicHelpers.h"
+#include "GameSaving/AwsGameKitSaveInfoIndex.h"
+#include "GameSaving/AwsGameKitSlotCache.h"
+
+// Unreal
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/UniquePtr.h"
+
+// Standard Library
+#include <atomic>
+
+TAutoConsoleVariable<int32> CVarGameKitGameSavingStreamChunkKB(
+    TEXT("GameKit.GameSaving.StreamChunkKB"),
+    1024,
+    TEXT("Size in kilobytes of the chunks AwsGameKitGameSaving::SaveSlotFromFile() and LoadSlotToFile() read and write save files in.\n")
+    TEXT("Progress is reported after every chunk.\n"));
+
+TAutoConsoleVariable<bool> CVarGameKitGameSavingMapSaveFiles(
+    TEXT("GameKit.GameSaving.MapSaveFiles"),
+    false,
+    TEXT("If true, AwsGameKitGameSaving::SaveSlotFromFile() uploads directly from the save file mapped into memory instead of reading it into a buffer.\n")
+    TEXT("Falls back to reading the file when the platform cannot map it.\n")
+    TEXT("Only enable this if the game never writes its save files while they are uploaded: truncating a mapped file crashes the upload on POSIX platforms,\n")
+    TEXT("and writing it fails with a sharing violation on Windows.\n"));
+
+TAutoConsoleVariable<int32> CVarGameKitGameSavingSyncMaxConcurrentTransfers(
+    TEXT("GameKit.GameSaving.SyncMaxConcurrentTransfers"),
+    4,
+    TEXT("Default maximum number of slots AwsGameKitGameSaving::SyncAllSlots() uploads or downloads at the same time.\n"));
+
+namespace
+{
+    int64 GetStreamChunkSize()
+    {
+        return (int64)FMath::Max(CVarGameKitGameSavingStreamChunkKB.GetValueOnAnyThread(), 4) * 1024;
+    }
+
+    void ReportTransferProgress(TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate, GameSavingTransferPhase_E Phase, int64 BytesTransferred, int64 TotalBytes)
+    {
+        if (ProgressDelegate.IsBound())
+        {
+            FGameSavingTransferProgress progress;
+            progress.Phase = Phase;
+            progress.BytesTransferred = BytesTransferred;
+            progress.TotalBytes = TotalBytes;
+            InternalAwsGameKitRunDelegateOnGameThread(ProgressDelegate, progress);
+        }
+    }
+
+    void ReportSlotActionError(TFunctionRef<void(FGameSavingSlotActionResults&)> OnComplete, unsigned int Status)
+    {
+        FGameSavingSlotActionResults results;
+        results.CallStatus = Status;
+        OnComplete(results);
+    }
+
+    // Completes a slot action by applying its slot to FAwsGameKitSlotCache and invoking ResultDelegate on the game thread
+    auto CompleteOnGameThread(TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
+    {
+        return [&ResultDelegate](FGameSavingSlotActionResults& Results)
+        {
+            InternalAwsGameKitRunOnGameThread([ResultDelegate, results = MoveTemp(Results)]() mutable
+            {
+                results.SlotsVersion = FAwsGameKitSlotCache::Get().Update(results.ActedOnSlot);
+                ResultDelegate.ExecuteIfBound(IntResult(results.CallStatus), results);
+            });
+        };
+    }
+
+    // Serializes Size bytes of Data to or from Archive one chunk at a time. Stops early when the call is cancelled.
+    bool SerializeInChunks(FArchive& Archive, uint8* Data, int64 Size, TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate, GameSavingTransferPhase_E Phase)
+    {
+        const int64 chunkSize = GetStreamChunkSize();
+        for (int64 offset = 0; offset < Size; offset += chunkSize)
+        {
+            if (InternalAwsGameKitIsOperationAbandoned())
+            {
+                return false;
+            }
+
+            const int64 length = FMath::Min(chunkSize, Size - offset);
+            Archive.Serialize(Data + offset, length);
+            if (Archive.IsError())
+            {
+                return false;
+            }
+
+            ReportTransferProgress(ProgressDelegate, Phase, offset + length, Size);
+        }
+
+        return true;
+    }
+
+    // Write Data to the temp file of FilePath and flush it, then rename it over FilePath so a cancelled or failed write never leaves a truncated file
+    bool WriteFileInChunks(const FString& FilePath, const uint8* Data, int64 Size, TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate)
+    {
+        IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+        const FString tempFilePath = DefaultFileActions::getTempFilePath(FilePath);
+        platformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+
+        TUniquePtr<IFileHandle> fileHandle(platformFile.OpenWrite(*tempFilePath));
+        bool bWritten = fileHandle.IsValid();
+        const int64 chunkSize = GetStreamChunkSize();
+        for (int64 offset = 0; bWritten && offset < Size; offset += chunkSize)
+        {
+            const int64 length = FMath::Min(chunkSize, Size - offset);
+            bWritten = !InternalAwsGameKitIsOperationAbandoned() && fileHandle->Write(Data + offset, length);
+            if (bWritten)
+            {
+                ReportTransferProgress(ProgressDelegate, GameSavingTransferPhase_E::WRITING_FILE, offset + length, Size);
+            }
+        }
+
+        bWritten = bWritten && fileHandle->Flush(true);
+        fileHandle.Reset();
+        if (!bWritten)
+        {
+            platformFile.DeleteFile(*tempFilePath);
+            return false;
+        }
+
+        return DefaultFileActions::commitDesktopFile(FilePath);
+    }
+}
 
-GameSavingLibrary AwsGameKitGameSaving::GetGameSavingLibraryFromModule()
+const GameSavingLibrary& AwsGameKitGameSaving::GetGameSavingLibraryFromModule()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::GetGameSavingLibraryFromModule()"));
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    return runtimeModule->GetGameSavingLibrary();
+    return FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
 }
 
-void AwsGameKitGameSaving::AddLocalSlots(const FFilePaths& LocalSlotInformationFilePaths, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitGameSaving::AddLocalSlots(const FFilePaths& LocalSlotInformationFilePaths, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::AddLocalSlots()"));
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.AddLocalSlots"), [=]
     {
-        FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        RunAddLocalSlots(LocalSlotInformationFilePaths.FilePaths);
+        const IntResult result = IntResult(GameKit::GAMEKIT_SUCCESS);
 
-        // Transform local slot information file paths into const char**
-        const unsigned int arraySize = LocalSlotInformationFilePaths.FilePaths.Num();
-        TArray<std::string> strFilePaths;
-        TArray<const char*> rawFilePaths;
-        strFilePaths.SetNum(arraySize);
-        rawFilePaths.SetNum(arraySize);
-        for (unsigned int i = 0; i < arraySize; ++i)
-        {
-            strFilePaths[i] = TCHAR_TO_UTF8(ToCStr(LocalSlotInformationFilePaths.FilePaths[i]));
-            rawFilePaths[i] = strFilePaths[i].c_str();
-        }
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result);
+    });
+}
+
+FAwsGameKitOperationHandle AwsGameKitGameSaving::AddLocalSlotsFromDirectory(const FString& SaveInfoDirectory, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
+{
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::AddLocalSlotsFromDirectory()"));
 
-        gameSavingLibrary.GameSavingWrapper->GameKitAddLocalSlots(gameSavingLibrary.GameSavingInstanceHandle, rawFilePaths.GetData(), arraySize);
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.AddLocalSlotsFromDirectory"), [=]
+    {
+        RunAddLocalSlots(FAwsGameKitSaveInfoIndex::Get().LoadDirectory(SaveInfoDirectory));
         const IntResult result = IntResult(GameKit::GAMEKIT_SUCCESS);
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result);
     });
 }
 
-void AwsGameKitGameSaving::SetFileActions(const FileActions& FileActions, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
+void AwsGameKitGameSaving::RunAddLocalSlots(const TArray<FString>& LocalSlotInformationFilePaths)
+{
+    const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
+
+    // Transform local slot information file paths into const char**
+    FAwsGameKitInternalUtf8Array rawFilePaths;
+    rawFilePaths.Append(LocalSlotInformationFilePaths);
+
+    gameSavingLibrary.GameSavingWrapper->GameKitAddLocalSlots(gameSavingLibrary.GameSavingInstanceHandle, rawFilePaths.GetData(), rawFilePaths.Num());
+}
+
+FAwsGameKitOperationHandle AwsGameKitGameSaving::SetFileActions(const FileActions& FileActions, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SetFileActions()"));
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.SetFileActions"), [=]
     {
-        FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
 
         gameSavingLibrary.GameSavingWrapper->GameKitSetFileActions(gameSavingLibrary.GameSavingInstanceHandle, FileActions);
         const IntResult result = IntResult(GameKit::GAMEKIT_SUCCESS);
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result);
     });
 }
 
-void AwsGameKitGameSaving::GetAllSlotSyncStatuses( TAwsGameKitDelegateParam<const IntResult&, const TArray<FGameSavingSlot>&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitGameSaving::GetAllSlotSyncStatuses( TAwsGameKitDelegateParam<const IntResult&, const TArray<FGameSavingSlot>&> ResultDelegate)
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::GetAllSlotSyncStatuses()"));
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.GetAllSlotSyncStatuses"), [=]
     {
-        FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
 
         auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, bool complete, unsigned int callStatus)
         {
             UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::GetAllSlotSyncStatuses() GetAllSlotSyncStatuses::Dispatch"));
 
-            TArray<FGameSavingSlot> results = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-
-            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), results);
+            if (InternalAwsGameKitIsOperationAbandoned())
+            {
+                return;
+            }
+
+            InternalAwsGameKitRunOnGameThread([ResultDelegate, callStatus, results = FGameSavingSlot::ToArray(cachedSlots, slotCount)]
+            {
+                if (callStatus == GameKit::GAMEKIT_SUCCESS)
+                {
+                    FAwsGameKitSlotCache::Get().Reset(results);
+                }
+                ResultDelegate.ExecuteIfBound(IntResult(callStatus), results);
+            });
         };
         typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, bool, unsigned int> Dispatcher;
 
@@ -85,25 +227,28 @@ void AwsGameKitGameSaving::GetAllSlotSyncStatuses( TAwsGameKitDelegateParam<cons
     });
 }
 
-void AwsGameKitGameSaving::GetSlotSyncStatus(const FGameSavingGetSlotSyncStatusRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitGameSaving::GetSlotSyncStatus(const FGameSavingGetSlotSyncStatusRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::GetSlotSyncStatus()"));
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.GetSlotSyncStatus"), [=]
     {
-        FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
 
         auto getSlotSyncStatusDispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
         {
             UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::GetSlotSyncStatus() GetSlotSyncStatus::Dispatch"));
 
+            if (InternalAwsGameKitIsOperationAbandoned())
+            {
+                return;
+            }
+
             FGameSavingSlotActionResults results;
-            results.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-            results.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
+            FAwsGameKitSlotCache::FillResults(results, cachedSlots, slotCount, actedOnSlot);
             results.CallStatus = callStatus;
 
-            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), results);
+            CompleteOnGameThread(ResultDelegate)(results);
         };
         typedef LambdaDispatcher<decltype(getSlotSyncStatusDispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> GetSlotSyncStatusDispatcher;
 
@@ -111,25 +256,33 @@ void AwsGameKitGameSaving::GetSlotSyncStatus(const FGameSavingGetSlotSyncStatusR
     });
 }
 
-void AwsGameKitGameSaving::DeleteSlot(const FGameSavingDeleteSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitGameSaving::DeleteSlot(const FGameSavingDeleteSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::DeleteSlot()"));
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.DeleteSlot"), [=]
     {
-        FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
 
         auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
         {
             UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::DeleteSlot() DeleteSlot::Dispatch"));
 
+            if (InternalAwsGameKitIsOperationAbandoned())
+            {
+                return;
+            }
+
             FGameSavingSlotActionResults results;
-            results.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-            results.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
+            FAwsGameKitSlotCache::FillResults(results, cachedSlots, slotCount, actedOnSlot);
             results.CallStatus = callStatus;
 
-            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), results);
+            InternalAwsGameKitRunOnGameThread([ResultDelegate, slotName = Request.SlotName, results = MoveTemp(results)]() mutable
+            {
+                FAwsGameKitSlotCache& slotCache = FAwsGameKitSlotCache::Get();
+                results.SlotsVersion = results.CallStatus == GameKit::GAMEKIT_SUCCESS ? slotCache.Remove(slotName) : slotCache.Update(results.ActedOnSlot);
+                ResultDelegate.ExecuteIfBound(IntResult(results.CallStatus), results);
+            });
         };
         typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
 
@@ -137,64 +290,470 @@ void AwsGameKitGameSaving::DeleteSlot(const FGameSavingDeleteSlotRequest& Reques
     });
 }
 
-void AwsGameKitGameSaving::SaveSlot(const FGameSavingSaveSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitGameSaving::SaveSlot(const FGameSavingSaveSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SaveSlot()"));
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return SaveSlotWithModel(ModelCache(Request), ResultDelegate);
+}
+
+FAwsGameKitOperationHandle AwsGameKitGameSaving::SaveSlot(FGameSavingSaveSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
+{
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SaveSlot()"));
+
+    return SaveSlotWithModel(ModelCache(MoveTemp(Request)), ResultDelegate);
+}
+
+FAwsGameKitOperationHandle AwsGameKitGameSaving::SaveSlot(const FGameSavingSaveSlotRequest& Request, const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>& Data, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
+{
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SaveSlot()"));
+
+    return SaveSlotWithModel(ModelCache(Request, Data), ResultDelegate);
+}
+
+FAwsGameKitOperationHandle AwsGameKitGameSaving::SaveSlotWithModel(ModelCache&& SaveSlotModel, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
+{
+    // The model, and the save file it holds, is moved into the work rather than copied
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.SaveSlot"), [modelCache = MoveTemp(SaveSlotModel), ResultDelegate]() mutable
     {
-        FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        RunSaveSlot(modelCache, CompleteOnGameThread(ResultDelegate));
+    });
+}
 
-        auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
+bool AwsGameKitGameSaving::IsSlotSynced(const char* SlotName, FGameSavingSlotActionResults& OutResults, FString& OutCloudDigest)
+{
+    const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
+    bool bSynced = false;
+
+    auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
+    {
+        FAwsGameKitSlotCache::FillResults(OutResults, cachedSlots, slotCount, actedOnSlot);
+        bSynced = callStatus == GameKit::GAMEKIT_SUCCESS && OutResults.ActedOnSlot.SlotSyncStatus == SlotSyncStatus_E::SYNCED;
+        if (actedOnSlot != nullptr && actedOnSlot->metadataCloud != nullptr)
         {
-            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SaveSlot() SaveSlot::Dispatch"));
+            OutCloudDigest = FAwsGameKitSaveDigest::ReadMetadataTag(UTF8_TO_TCHAR(actedOnSlot->metadataCloud));
+        }
+    };
+    typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
 
-            FGameSavingSlotActionResults results;
-            results.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-            results.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
-            results.CallStatus = callStatus;
+    gameSavingLibrary.GameSavingWrapper->GameKitGetSlotSyncStatus(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, SlotName);
+    return bSynced;
+}
 
-            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), results);
-        };
-        typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
+void AwsGameKitGameSaving::RunSaveSlot(ModelCache& SaveSlotModel, FSlotActionCompletion OnComplete)
+{
+    // An unchanged save only costs a sync status call instead of an upload
+    FGameSavingSlotActionResults syncedResults;
+    FString cloudDigest;
+    if (SaveSlotModel.PrepareUploadDigest() && IsSlotSynced(SaveSlotModel.GetSlotName(), syncedResults, cloudDigest) && SaveSlotModel.MatchesUploadDigest(cloudDigest))
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SaveSlot() Slot %s is unchanged since its last upload, skipping the upload."), UTF8_TO_TCHAR(SaveSlotModel.GetSlotName()));
+        syncedResults.CallStatus = GameKit::GAMEKIT_ERROR_GAME_SAVING_UPLOAD_SLOT_ALREADY_IN_SYNC;
+        OnComplete(syncedResults);
+        return;
+    }
 
-        ModelCache modelCache(Request);
-        GameSavingModel gameSavingModel = modelCache;
-        gameSavingLibrary.GameSavingWrapper->GameKitSaveSlot(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, gameSavingModel);
-    });
+    if (!SaveSlotModel.CompressData())
+    {
+        ReportSlotActionError(OnComplete, GameKit::GAMEKIT_ERROR_GENERAL);
+        return;
+    }
+
+    const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
+
+    auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SaveSlot() SaveSlot::Dispatch"));
+
+        if (InternalAwsGameKitIsOperationAbandoned())
+        {
+            return;
+        }
+
+        FGameSavingSlotActionResults results;
+        FAwsGameKitSlotCache::FillResults(results, cachedSlots, slotCount, actedOnSlot);
+        results.CallStatus = callStatus;
+
+        OnComplete(results);
+    };
+    typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
+
+    GameSavingModel gameSavingModel = SaveSlotModel;
+    gameSavingLibrary.GameSavingWrapper->GameKitSaveSlot(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, gameSavingModel);
 }
 
-void AwsGameKitGameSaving::LoadSlot(const FGameSavingLoadSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitGameSaving::LoadSlot(const FGameSavingLoadSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&> ResultDelegate)
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::LoadSlot()"));
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return LoadSlotWithModel(ModelCache(Request), TAwsGameKitDelegate<const IntResult&, FGameSavingDataResults&>::CreateLambda(
+        [ResultDelegate](const IntResult& Result, FGameSavingDataResults& Results)
+        {
+            ResultDelegate.ExecuteIfBound(Result, Results);
+        }));
+}
+
+FAwsGameKitOperationHandle AwsGameKitGameSaving::LoadSlot(FGameSavingLoadSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, FGameSavingDataResults&> ResultDelegate)
+{
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::LoadSlot()"));
+
+    return LoadSlotWithModel(ModelCache(MoveTemp(Request)), ResultDelegate);
+}
+
+FAwsGameKitOperationHandle AwsGameKitGameSaving::LoadSlotWithModel(ModelCache&& LoadSlotModel, TAwsGameKitDelegateParam<const IntResult&, FGameSavingDataResults&> ResultDelegate)
+{
+    // The destination buffer lives in the model: it is downloaded into, then moved into the results and on to the game thread
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.LoadSlot"), [modelCache = MoveTemp(LoadSlotModel), ResultDelegate]() mutable
     {
-        FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
 
         auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, const uint8_t* data, unsigned int dataSize, unsigned int callStatus)
         {
             UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::LoadSlot() LoadSlot::Dispatch"));
 
+            if (InternalAwsGameKitIsOperationAbandoned())
+            {
+                return;
+            }
+
             FGameSavingDataResults results;
-            results.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-            results.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
-            results.Data.AddUninitialized(dataSize);
-            FMemory::Memcpy(results.Data.GetData(), (uint8*)data, dataSize);
+            FAwsGameKitSlotCache::FillResults(results, cachedSlots, slotCount, actedOnSlot);
+            results.Data = modelCache.TakeLoadedData(data, dataSize);
+            if (callStatus == GameKit::GAMEKIT_SUCCESS && !ModelCache::DecompressLoadedData(results.Data, actedOnSlot))
+            {
+                callStatus = GameKit::GAMEKIT_ERROR_GENERAL;
+            }
             results.CallStatus = callStatus;
 
-            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), results);
+            InternalAwsGameKitRunOnGameThread([ResultDelegate, callStatus, results = MoveTemp(results)]() mutable
+            {
+                results.SlotsVersion = FAwsGameKitSlotCache::Get().Update(results.ActedOnSlot);
+                ResultDelegate.ExecuteIfBound(IntResult(callStatus), results);
+            });
         };
         typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, const uint8_t*, unsigned int, unsigned int> Dispatcher;
 
-        ModelCache modelCache(Request);
         GameSavingModel gameSavingModel = modelCache;
         gameSavingLibrary.GameSavingWrapper->GameKitLoadSlot(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, gameSavingModel);
     });
 }
 
+FAwsGameKitOperationHandle AwsGameKitGameSaving::SaveSlotFromFile(const FGameSavingSaveSlotRequest& Request, const FString& SaveFilePath, TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
+{
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SaveSlotFromFile()"));
+
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.SaveSlotFromFile"), [=]
+    {
+        RunSaveSlotFromFile(Request, SaveFilePath, ProgressDelegate, CompleteOnGameThread(ResultDelegate));
+    });
+}
+
+void AwsGameKitGameSaving::RunSaveSlotFromFile(const FGameSavingSaveSlotRequest& Request, const FString& SaveFilePath, TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate, FSlotActionCompletion OnComplete)
+{
+    TUniquePtr<FAwsGameKitMappedSaveFile> mappedFile = CVarGameKitGameSavingMapSaveFiles.GetValueOnAnyThread() ? FAwsGameKitMappedSaveFile::Open(SaveFilePath) : nullptr;
+    if (mappedFile)
+    {
+        // Nothing is read up front, the pages are read as the library uploads them, so there is no READING_FILE progress to report
+        const int64 fileSize = mappedFile->GetData().Num();
+        ReportTransferProgress(ProgressDelegate, GameSavingTransferPhase_E::UPLOADING, 0, fileSize);
+
+        ModelCache modelCache(Request, MoveTemp(mappedFile));
+        RunSaveSlot(modelCache, OnComplete);
+        return;
+    }
+
+    TUniquePtr<FArchive> reader(IFileManager::Get().CreateFileReader(*SaveFilePath));
+    if (!reader)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitGameSaving::SaveSlotFromFile() Unable to open file: %s"), *SaveFilePath);
+        ReportSlotActionError(OnComplete, GameKit::GAMEKIT_ERROR_FILE_OPEN_FAILED);
+        return;
+    }
+
+    const int64 fileSize = reader->TotalSize();
+    if (fileSize > MAX_int32)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitGameSaving::SaveSlotFromFile() File %s is %lld bytes, larger than the 2 GB limit."), *SaveFilePath, fileSize);
+        ReportSlotActionError(OnComplete, GameKit::GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE);
+        return;
+    }
+
+    FGameSavingSaveSlotRequest saveRequest;
+    saveRequest.SlotName = Request.SlotName;
+    saveRequest.SaveInfoFilePath = Request.SaveInfoFilePath;
+    saveRequest.Metadata = Request.Metadata;
+    saveRequest.EpochTime = Request.EpochTime;
+    saveRequest.OverrideSync = Request.OverrideSync;
+    saveRequest.Compression = Request.Compression;
+    saveRequest.SkipUploadIfUnchanged = Request.SkipUploadIfUnchanged;
+    saveRequest.Data = FAwsGameKitSaveBufferPool::Get().Acquire((int32)fileSize);
+
+    const bool bRead = SerializeInChunks(*reader, saveRequest.Data.GetData(), fileSize, ProgressDelegate, GameSavingTransferPhase_E::READING_FILE);
+    reader.Reset();
+    if (!bRead)
+    {
+        FAwsGameKitSaveBufferPool::Get().Release(MoveTemp(saveRequest.Data));
+        if (!InternalAwsGameKitIsOperationAbandoned())
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitGameSaving::SaveSlotFromFile() Unable to read file: %s"), *SaveFilePath);
+            ReportSlotActionError(OnComplete, GameKit::GAMEKIT_ERROR_FILE_READ_FAILED);
+        }
+        return;
+    }
+
+    ReportTransferProgress(ProgressDelegate, GameSavingTransferPhase_E::UPLOADING, 0, fileSize);
+
+    ModelCache modelCache(MoveTemp(saveRequest));
+    RunSaveSlot(modelCache, OnComplete);
+    FAwsGameKitSaveBufferPool::Get().Release(modelCache.ReleaseData());
+}
+
+FAwsGameKitOperationHandle AwsGameKitGameSaving::LoadSlotToFile(const FGameSavingLoadSlotRequest& Request, const FString& SaveFilePath, TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
+{
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::LoadSlotToFile()"));
+
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.LoadSlotToFile"), [=]
+    {
+        RunLoadSlotToFile(Request, SaveFilePath, ProgressDelegate, CompleteOnGameThread(ResultDelegate));
+    });
+}
+
+void AwsGameKitGameSaving::RunLoadSlotToFile(const FGameSavingLoadSlotRequest& Request, const FString& SaveFilePath, TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate, FSlotActionCompletion OnComplete)
+{
+    const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
+
+    // Size the download buffer from the current size of the cloud file
+    int64 cloudSize = 0;
+    auto getSlotSyncStatusDispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
+    {
+        if (callStatus == GameKit::GAMEKIT_SUCCESS && actedOnSlot != nullptr)
+        {
+            cloudSize = actedOnSlot->sizeCloud;
+        }
+    };
+    typedef LambdaDispatcher<decltype(getSlotSyncStatusDispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> GetSlotSyncStatusDispatcher;
+
+    const unsigned int statusResult = gameSavingLibrary.GameSavingWrapper->GameKitGetSlotSyncStatus(gameSavingLibrary.GameSavingInstanceHandle, &getSlotSyncStatusDispatcher, GetSlotSyncStatusDispatcher::Dispatch, TCHAR_TO_UTF8(*Request.SlotName));
+    if (InternalAwsGameKitIsOperationAbandoned())
+    {
+        return;
+    }
+
+    if (statusResult != GameKit::GAMEKIT_SUCCESS)
+    {
+        ReportSlotActionError(OnComplete, statusResult);
+        return;
+    }
+
+    if (cloudSize > MAX_int32)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitGameSaving::LoadSlotToFile() Slot %s is %lld bytes, larger than the 2 GB limit."), *Request.SlotName, cloudSize);
+        ReportSlotActionError(OnComplete, GameKit::GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE);
+        return;
+    }
+
+    FGameSavingLoadSlotRequest loadRequest;
+    loadRequest.SlotName = Request.SlotName;
+    loadRequest.SaveInfoFilePath = Request.SaveInfoFilePath;
+    loadRequest.OverrideSync = Request.OverrideSync;
+    loadRequest.Data = FAwsGameKitSaveBufferPool::Get().Acquire((int32)cloudSize);
+    ModelCache modelCache(MoveTemp(loadRequest));
+
+    ReportTransferProgress(ProgressDelegate, GameSavingTransferPhase_E::DOWNLOADING, 0, cloudSize);
+
+    auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, const uint8_t* data, unsigned int dataSize, unsigned int callStatus)
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::LoadSlotToFile() LoadSlot::Dispatch"));
+
+        TArray<uint8> loadedData = modelCache.TakeLoadedData(data, dataSize);
+        if (InternalAwsGameKitIsOperationAbandoned())
+        {
+            FAwsGameKitSaveBufferPool::Get().Release(MoveTemp(loadedData));
+            return;
+        }
+
+        if (callStatus == GameKit::GAMEKIT_SUCCESS)
+        {
+            ReportTransferProgress(ProgressDelegate, GameSavingTransferPhase_E::DOWNLOADING, dataSize, dataSize);
+
+            // Keep the downloaded buffer for the pool, decompress into a separate one
+            TArray<uint8> decompressedData;
+            FName formatName;
+            int64 rawSize = 0;
+            const bool bCompressed = ModelCache::GetLoadedCompression(actedOnSlot, formatName, rawSize);
+            if (bCompressed && !FAwsGameKitSaveCompression::Decompress(loadedData, formatName, rawSize, decompressedData))
+            {
+                callStatus = GameKit::GAMEKIT_ERROR_GENERAL;
+            }
+            else
+            {
+                TArray<uint8>& fileData = bCompressed ? decompressedData : loadedData;
+                if (!WriteFileInChunks(SaveFilePath, fileData.GetData(), fileData.Num(), ProgressDelegate))
+                {
+                    UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitGameSaving::LoadSlotToFile() Unable to write file: %s"), *SaveFilePath);
+                    callStatus = GameKit::GAMEKIT_ERROR_FILE_WRITE_FAILED;
+                }
+            }
+        }
+
+        FAwsGameKitSaveBufferPool::Get().Release(MoveTemp(loadedData));
+
+        FGameSavingSlotActionResults results;
+        FAwsGameKitSlotCache::FillResults(results, cachedSlots, slotCount, actedOnSlot);
+        results.CallStatus = callStatus;
+
+        OnComplete(results);
+    };
+    typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, const uint8_t*, unsigned int, unsigned int> Dispatcher;
+
+    GameSavingModel gameSavingModel = modelCache;
+    gameSavingLibrary.GameSavingWrapper->GameKitLoadSlot(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, gameSavingModel);
+}
+
+FAwsGameKitOperationHandle AwsGameKitGameSaving::SyncAllSlots(const FGameSavingSyncAllSlotsRequest& Request, TAwsGameKitDelegateParam<const FGameSavingSyncProgress&> ProgressDelegate, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSyncAllSlotsResults&> ResultDelegate)
+{
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SyncAllSlots()"));
+
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::GameStateCloudSaving, TEXT("GameSaving.SyncAllSlots"), [=]
+    {
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
+        FGameSavingSyncAllSlotsResults results;
+
+        // The sync status of every slot is fetched once, up front
+        auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, bool complete, unsigned int callStatus)
+        {
+            results.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
+        };
+        typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, bool, unsigned int> Dispatcher;
+
+        const bool shouldWaitForAllPages = true;
+        const unsigned int defaultPageSize = GameKit::GameSaving::Wrapper::GetAllSlotSyncStatusesDefaultPageSize;
+        results.CallStatus = gameSavingLibrary.GameSavingWrapper->GameKitGetAllSlotSyncStatuses(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, shouldWaitForAllPages, defaultPageSize);
+        if (InternalAwsGameKitIsOperationAbandoned())
+        {
+            return;
+        }
+
+        if (results.CallStatus != GameKit::GAMEKIT_SUCCESS)
+        {
+            InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, IntResult(results.CallStatus), results);
+            return;
+        }
+
+        TArray<FGameSavingSlot> transfers;
+        FGameSavingSyncProgress progress;
+        for (const FGameSavingSlot& slot : results.Slots.Slots)
+        {
+            switch (slot.SlotSyncStatus)
+            {
+            case SlotSyncStatus_E::SHOULD_UPLOAD_LOCAL:
+                transfers.Add(slot);
+                progress.TotalBytes += slot.SizeLocal;
+                break;
+            case SlotSyncStatus_E::SHOULD_DOWNLOAD_CLOUD:
+                transfers.Add(slot);
+                progress.TotalBytes += slot.SizeCloud;
+                break;
+            case SlotSyncStatus_E::IN_CONFLICT:
+                results.Conflicts.Add(slot);
+                break;
+            default:
+                break;
+            }
+        }
+        progress.SlotsTotal = transfers.Num();
+
+        const TAwsGameKitDelegate<const FGameSavingTransferProgress&> noTransferProgress;
+        FCriticalSection resultsMutex;
+        std::atomic<int32> nextTransfer { 0 };
+
+        // Each worker takes the next slot until none are left
+        auto runTransfers = [&]()
+        {
+            for (int32 index = nextTransfer++; index < transfers.Num() && !InternalAwsGameKitIsOperationAbandoned(); index = nextTransfer++)
+            {
+                const FGameSavingSlot& slot = transfers[index];
+                const bool bUpload = slot.SlotSyncStatus == SlotSyncStatus_E::SHOULD_UPLOAD_LOCAL;
+                const FString saveFilePath = FPaths::Combine(Request.SaveDirectory, slot.SlotName + Request.SaveFileExtension);
+                const FString saveInfoFilePath = saveFilePath + GetSaveInfoFileExtension();
+
+                FGameSavingSlotActionResults slotResults;
+                slotResults.CallStatus = GameKit::GAMEKIT_ERROR_GENERAL;
+                auto onComplete = [&slotResults](FGameSavingSlotActionResults& Results)
+                {
+                    slotResults = MoveTemp(Results);
+                };
+
+                if (bUpload)
+                {
+                    FGameSavingSaveSlotRequest saveRequest;
+                    saveRequest.SlotName = slot.SlotName;
+                    saveRequest.SaveInfoFilePath = saveInfoFilePath;
+                    saveRequest.Metadata = slot.MetadataLocal;
+                    saveRequest.Compression = Request.Compression;
+                    saveRequest.SkipUploadIfUnchanged = Request.SkipUploadIfUnchanged;
+                    UAwsGameKitFileUtils::GetFileLastModifiedTimestamp(saveFilePath, saveRequest.EpochTime);
+                    RunSaveSlotFromFile(saveRequest, saveFilePath, noTransferProgress, onComplete);
+                }
+                else
+                {
+                    FGameSavingLoadSlotRequest loadRequest;
+                    loadRequest.SlotName = slot.SlotName;
+                    loadRequest.SaveInfoFilePath = saveInfoFilePath;
+                    RunLoadSlotToFile(loadRequest, saveFilePath, noTransferProgress, onComplete);
+                }
+
+                FScopeLock resultsLock(&resultsMutex);
+                if (slotResults.CallStatus == GameKit::GAMEKIT_SUCCESS)
+                {
+                    (bUpload ? results.UploadedSlots : results.DownloadedSlots).Add(slot.SlotName);
+                }
+                else
+                {
+                    UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitGameSaving::SyncAllSlots() Unable to %s slot %s, status 0x%x."), bUpload ? TEXT("upload") : TEXT("download"), *slot.SlotName, slotResults.CallStatus);
+                    results.FailedSlots.Add(slot.SlotName);
+                    if (results.CallStatus == GameKit::GAMEKIT_SUCCESS)
+                    {
+                        results.CallStatus = slotResults.CallStatus;
+                    }
+                }
+
+                // Only the transferred slot changed, so the rest of the statuses fetched up front are still current
+                if (!slotResults.ActedOnSlot.SlotName.IsEmpty())
+                {
+                    FGameSavingSlot* syncedSlot = results.Slots.Slots.FindByPredicate([&slotResults](const FGameSavingSlot& Slot) { return Slot.SlotName == slotResults.ActedOnSlot.SlotName; });
+                    if (syncedSlot != nullptr)
+                    {
+                        *syncedSlot = MoveTemp(slotResults.ActedOnSlot);
+                    }
+                }
+
+                progress.SlotsCompleted++;
+                progress.BytesTransferred += bUpload ? slot.SizeLocal : slot.SizeCloud;
+                if (ProgressDelegate.IsBound())
+                {
+                    InternalAwsGameKitRunDelegateOnGameThread(ProgressDelegate, progress);
+                }
+            }
+        };
+
+        const int32 maxConcurrentTransfers = Request.MaxConcurrentTransfers > 0 ? Request.MaxConcurrentTransfers : CVarGameKitGameSavingSyncMaxConcurrentTransfers.GetValueOnAnyThread();
+        const int32 workerCount = FMath::Clamp(maxConcurrentTransfers, 1, FMath::Max(transfers.Num(), 1));
+        InternalAwsGameKitRunOnWorkers(FeatureType_E::GameStateCloudSaving, workerCount, runTransfers);
+
+        if (InternalAwsGameKitIsOperationAbandoned())
+        {
+            return;
+        }
+
+        InternalAwsGameKitRunOnGameThread([ResultDelegate, results = MoveTemp(results)]
+        {
+            FAwsGameKitSlotCache::Get().Reset(results.Slots.Slots);
+            ResultDelegate.ExecuteIfBound(IntResult(results.CallStatus), results);
+        });
+    });
+}
+
 FString AwsGameKitGameSaving::GetSaveInfoFileExtension()
 {
     return GameKit::GameSaving::Wrapper::SaveInfoFileExtension;
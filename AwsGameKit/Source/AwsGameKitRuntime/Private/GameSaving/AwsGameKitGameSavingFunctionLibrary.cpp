@@ -8,9 +8,12 @@
 // GameKit
 #include "AwsGameKitCore.h"
 #include "AwsGameKitRuntime.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
 #include "Core/AwsGameKitDispatcher.h"
 #include "Core/AwsGameKitErrors.h"
 #include "Core/Logging.h"
+#include "GameSaving/AwsGameKitGameSaving.h"
+#include "GameSaving/AwsGameKitSlotCache.h"
 
 // Standard library
 #include <vector>
@@ -23,6 +26,19 @@
  */
 #define DISPATCHER &dispatcher, &Dispatcher::Dispatch
 
+namespace
+{
+    // Applies the acted on slot to the slot cache on the game thread right before the latent action completes, so GetCachedSlots() already has it
+    template <typename ResultType>
+    void UpdateSlotCacheOnCompletion(const TAwsGameKitInternalActionStatePtr<ResultType>& State)
+    {
+        State->CompleteOnGameThread = [](ResultType& Results)
+        {
+            Results.SlotsVersion = FAwsGameKitSlotCache::Get().Update(Results.ActedOnSlot);
+        };
+    }
+}
+
 void UAwsGameKitGameSavingFunctionLibrary::AddLocalSlots(
     UObject* WorldContextObject,
     FLatentActionInfo LatentInfo,
@@ -37,22 +53,13 @@ void UAwsGameKitGameSavingFunctionLibrary::AddLocalSlots(
     {
         Action->LaunchThreadedWork([FilePaths, State]
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
 
                 // Transform local slot information file paths into const char**
-                const unsigned int arraySize = FilePaths.FilePaths.Num();
-                TArray<std::string> strFilePaths;
-                TArray<const char*> rawFilePaths;
-                strFilePaths.SetNum(arraySize);
-                rawFilePaths.SetNum(arraySize);
-                for (unsigned int i = 0; i < arraySize; ++i)
-                {
-                    strFilePaths[i] = TCHAR_TO_UTF8(*FilePaths.FilePaths[i]);
-                    rawFilePaths[i] = strFilePaths[i].c_str();
-                }
+                FAwsGameKitInternalUtf8Array rawFilePaths;
+                rawFilePaths.Append(FilePaths.FilePaths);
                 
-                gameSavingLibrary.GameSavingWrapper->GameKitAddLocalSlots(gameSavingLibrary.GameSavingInstanceHandle, rawFilePaths.GetData(), arraySize);
+                gameSavingLibrary.GameSavingWrapper->GameKitAddLocalSlots(gameSavingLibrary.GameSavingInstanceHandle, rawFilePaths.GetData(), rawFilePaths.Num());
                 IntResult result = IntResult(GameKit::GAMEKIT_SUCCESS);
                 State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
             });
@@ -73,14 +80,24 @@ void UAwsGameKitGameSavingFunctionLibrary::GetAllSlotSyncStatuses(
     {
         Action->LaunchThreadedWork([State]
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
 
                 auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, bool complete, unsigned int callStatus)
                 {
                     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetAllSlotSyncStatuses(): GetAllSlotSyncStatuses::Dispatch"));
+                    if (InternalAwsGameKitIsOperationAbandoned())
+                    {
+                        return;
+                    }
 
                     TArray<FGameSavingSlot> gameSavingResults = FGameSavingSlot::ToArray(cachedSlots, slotCount);
+                    if (callStatus == GameKit::GAMEKIT_SUCCESS)
+                    {
+                        State->CompleteOnGameThread = [](TArray<FGameSavingSlot>& Results)
+                        {
+                            FAwsGameKitSlotCache::Get().Reset(Results);
+                        };
+                    }
 
                     State->Results = MoveTemp(gameSavingResults);
                 };
@@ -109,18 +126,21 @@ void UAwsGameKitGameSavingFunctionLibrary::GetSlotSyncStatus(
     {
         Action->LaunchThreadedWork([State, Request]
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
 
                 auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* slot, unsigned int callStatus)
                 {
                     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetSlotSyncStatus() GetSlotSyncStatus::Dispatch"));
+                    if (InternalAwsGameKitIsOperationAbandoned())
+                    {
+                        return;
+                    }
 
                     FGameSavingSlotActionResults gameSavingResults;
-                    gameSavingResults.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-                    gameSavingResults.ActedOnSlot = FGameSavingSlot::From(*slot);
+                    FAwsGameKitSlotCache::FillResults(gameSavingResults, cachedSlots, slotCount, slot);
+                    UpdateSlotCacheOnCompletion(State);
 
-                    State->Results = gameSavingResults;
+                    State->Results = MoveTemp(gameSavingResults);
                 };
                 typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
 
@@ -145,18 +165,31 @@ void UAwsGameKitGameSavingFunctionLibrary::DeleteSlot(
     {
         Action->LaunchThreadedWork([State, Request]
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
 
                 auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* slot, unsigned int callStatus)
                 {
                     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::DeleteSlot() DeleteSlot::Dispatch"));
+                    if (InternalAwsGameKitIsOperationAbandoned())
+                    {
+                        return;
+                    }
 
                     FGameSavingSlotActionResults gameSavingResults;
-                    gameSavingResults.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-                    gameSavingResults.ActedOnSlot = FGameSavingSlot::From(*slot);
+                    FAwsGameKitSlotCache::FillResults(gameSavingResults, cachedSlots, slotCount, slot);
+                    if (callStatus == GameKit::GAMEKIT_SUCCESS)
+                    {
+                        State->CompleteOnGameThread = [slotName = Request.SlotName](FGameSavingSlotActionResults& Results)
+                        {
+                            Results.SlotsVersion = FAwsGameKitSlotCache::Get().Remove(slotName);
+                        };
+                    }
+                    else
+                    {
+                        UpdateSlotCacheOnCompletion(State);
+                    }
 
-                    State->Results = gameSavingResults;
+                    State->Results = MoveTemp(gameSavingResults);
                 };
                 typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
 
@@ -179,28 +212,17 @@ void UAwsGameKitGameSavingFunctionLibrary::SaveSlot(
     TAwsGameKitInternalActionStatePtr<FGameSavingSlotActionResults> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([State, Request]
+        // Copy the request into the model once, here, and move the model into the threaded work
+        Action->LaunchThreadedWork([State, modelCache = ModelCache(Request)]() mutable
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
-
-                auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* slot, unsigned int callStatus)
+                // Same digest skip, compression and upload as AwsGameKitGameSaving::SaveSlot()
+                AwsGameKitGameSaving::RunSaveSlot(modelCache, [&State](FGameSavingSlotActionResults& SlotResults)
                 {
                     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::SaveSlot() SaveSlot::Dispatch"));
-
-                    FGameSavingSlotActionResults gameSavingResults;
-                    gameSavingResults.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-                    gameSavingResults.ActedOnSlot = FGameSavingSlot::From(*slot);
-
-                    State->Results = gameSavingResults;
-                };
-                typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
-
-                ModelCache modelCache(Request);
-                GameSavingModel gameSavingModel = modelCache;
-
-                IntResult result = IntResult(gameSavingLibrary.GameSavingWrapper->GameKitSaveSlot(gameSavingLibrary.GameSavingInstanceHandle, DISPATCHER, gameSavingModel));
-                State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
+                    UpdateSlotCacheOnCompletion(State);
+                    State->Err = FAwsGameKitOperationResult{ static_cast<int>(SlotResults.CallStatus), FString() };
+                    State->Results = MoveTemp(SlotResults);
+                });
             });
     }
 }
@@ -218,29 +240,41 @@ void UAwsGameKitGameSavingFunctionLibrary::LoadSlot(
     TAwsGameKitInternalActionStatePtr<FGameSavingDataResults> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([State, Request]
+        // The model owns the destination buffer, which is moved into the results once downloaded
+        Action->LaunchThreadedWork([State, modelCache = ModelCache(Request)]() mutable
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+                bool bDecompressFailed = false;
 
                 auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* slot, const uint8_t* data, unsigned int dataSize, unsigned int callStatus)
                 { 
                     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::LoadSlot() LoadSlot::Dispatch"));
+                    if (InternalAwsGameKitIsOperationAbandoned())
+                    {
+                        return;
+                    }
 
                     FGameSavingDataResults gameSavingResults;
-                    gameSavingResults.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-                    gameSavingResults.ActedOnSlot = FGameSavingSlot::From(*slot);
-                    gameSavingResults.Data.AddUninitialized(dataSize);
-                    FMemory::Memcpy(gameSavingResults.Data.GetData(), (uint8*)data, dataSize);
+                    FAwsGameKitSlotCache::FillResults(gameSavingResults, cachedSlots, slotCount, slot);
+                    UpdateSlotCacheOnCompletion(State);
+                    gameSavingResults.Data = modelCache.TakeLoadedData(data, dataSize);
+                    if (!ModelCache::DecompressLoadedData(gameSavingResults.Data, slot))
+                    {
+                        gameSavingResults.Data.Reset();
+                        bDecompressFailed = true;
+                    }
 
-                    State->Results = gameSavingResults;
+                    State->Results = MoveTemp(gameSavingResults);
                 }; 
                 typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, const uint8_t*, unsigned int, unsigned int> Dispatcher;
 
-                ModelCache modelCache(Request);
                 GameSavingModel gameSavingModel = modelCache;
 
                 IntResult result = IntResult(gameSavingLibrary.GameSavingWrapper->GameKitLoadSlot(gameSavingLibrary.GameSavingInstanceHandle, DISPATCHER, gameSavingModel));
+                if (bDecompressFailed)
+                {
+                    result = IntResult(GameKit::GAMEKIT_ERROR_GENERAL, TEXT("Unable to decompress the save file."));
+                }
                 State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
             });
     }
@@ -254,6 +288,13 @@ FString UAwsGameKitGameSavingFunctionLibrary::EpochToHumanReadable(int64 epochTi
     return FDateTime::FromUnixTimestamp(epochSeconds).ToHttpDate();
 }
 
+void UAwsGameKitGameSavingFunctionLibrary::GetCachedSlots(TArray<FGameSavingSlot>& Slots, int64& SlotsVersion)
+{
+    const FAwsGameKitSlotCache& slotCache = FAwsGameKitSlotCache::Get();
+    slotCache.GetSlots().GenerateValueArray(Slots);
+    SlotsVersion = slotCache.GetVersion();
+}
+
 FString UAwsGameKitGameSavingFunctionLibrary::GetSaveInfoFileExtension()
 {
     return GameKit::GameSaving::Wrapper::SaveInfoFileExtension;
@@ -6,7 +6,24 @@
 // GameKit
 #include "AwsGameKitCore.h"
 #include "Core/AwsGameKitErrors.h"
-#include "Misc/FileHelper.h"
+#include "GameSaving/AwsGameKitSaveInfoIndex.h"
+
+// Unreal
+#include "Async/AsyncFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Templates/UniquePtr.h"
+
+namespace
+{
+    // A save being written, and a save that is completely written and flushed but not yet renamed over the previous one
+    const TCHAR* TempFileSuffix = TEXT(".tmp");
+    const TCHAR* CompleteFileSuffix = TEXT(".new");
+
+    // Reads are split into blocks which are all requested at once, so the platform can overlap them
+    constexpr int64 ReadBlockSize = 1024 * 1024;
+}
 
 void AwsGameKitGameSavingWrapper::importFunctions(void* loadedDllHandle)
 {
@@ -134,7 +151,7 @@ DefaultFileActions::DefaultFileActions()
     fileSizeDispatchReceiver = nullptr;
 }
 
-bool DefaultFileActions::writeDesktopFile(const FString& filePath, const TArray<uint8>& data)
+bool DefaultFileActions::writeDesktopFile(const FString& filePath, TArrayView<const uint8> data)
 {
     if (filePath.IsEmpty())
     {
@@ -142,16 +159,67 @@ bool DefaultFileActions::writeDesktopFile(const FString& filePath, const TArray<
         return false;
     }
 
-    if (!FFileHelper::SaveArrayToFile(data, *filePath))
+    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+    const FString tempFilePath = getTempFilePath(filePath);
+
+    platformFile.CreateDirectoryTree(*FPaths::GetPath(filePath));
+
+    TUniquePtr<IFileHandle> fileHandle(platformFile.OpenWrite(*tempFilePath));
+    const bool bWritten = fileHandle && fileHandle->Write(data.GetData(), data.Num()) && fileHandle->Flush(true);
+    fileHandle.Reset();
+    if (!bWritten)
+    {
+        platformFile.DeleteFile(*tempFilePath);
+        UE_LOG(LogAwsGameKit, Error, TEXT("DesktopWriteFile() ERROR: Unable to load data to file: %s"), *tempFilePath);
+        return false;
+    }
+
+    return commitDesktopFile(filePath);
+}
+
+FString DefaultFileActions::getTempFilePath(const FString& filePath)
+{
+    return filePath + TempFileSuffix;
+}
+
+bool DefaultFileActions::commitDesktopFile(const FString& filePath)
+{
+    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+    const FString tempFilePath = getTempFilePath(filePath);
+    const FString completeFilePath = filePath + CompleteFileSuffix;
+
+    // Until the complete file replaces the previous one, a crash leaves either the previous file or the complete file in place, never a truncated one
+    platformFile.DeleteFile(*completeFilePath);
+    if (!platformFile.MoveFile(*completeFilePath, *tempFilePath))
+    {
+        platformFile.DeleteFile(*tempFilePath);
+        UE_LOG(LogAwsGameKit, Error, TEXT("DesktopWriteFile() ERROR: Unable to rename %s to %s"), *tempFilePath, *completeFilePath);
+        return false;
+    }
+
+    // Renaming over an existing file is atomic where the platform supports it, otherwise the previous file is deleted first
+    if (!platformFile.MoveFile(*filePath, *completeFilePath)
+        && !(platformFile.DeleteFile(*filePath) && platformFile.MoveFile(*filePath, *completeFilePath)))
     {
-        FString errorMessage = "ERROR: Unable to load data to file: " + filePath;
-        UE_LOG(LogAwsGameKit, Error, TEXT("DesktopWriteFile(): %s"), *errorMessage);
+        UE_LOG(LogAwsGameKit, Error, TEXT("DesktopWriteFile() ERROR: Unable to rename %s to %s"), *completeFilePath, *filePath);
         return false;
     }
+
     return true;
 }
 
-bool DefaultFileActions::readDesktopFile(const FString& filePath, TArray<uint8>& data)
+void DefaultFileActions::recoverDesktopFile(const FString& filePath)
+{
+    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+    const FString completeFilePath = filePath + CompleteFileSuffix;
+    if (!platformFile.FileExists(*filePath) && platformFile.FileExists(*completeFilePath))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("DesktopRecoverFile() Completing an interrupted write of file: %s"), *filePath);
+        platformFile.MoveFile(*filePath, *completeFilePath);
+    }
+}
+
+bool DefaultFileActions::readDesktopFile(const FString& filePath, uint8* data, int64 size)
 {
     if (filePath.IsEmpty())
     {
@@ -159,47 +227,104 @@ bool DefaultFileActions::readDesktopFile(const FString& filePath, TArray<uint8>&
         return false;
     }
 
-    if (!FFileHelper::LoadFileToArray(data, *filePath))
+    recoverDesktopFile(filePath);
+
+    TUniquePtr<IAsyncReadFileHandle> fileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*filePath));
+    TUniquePtr<IAsyncReadRequest> sizeRequest(fileHandle ? fileHandle->SizeRequest() : nullptr);
+    if (!sizeRequest)
     {
         UE_LOG(LogAwsGameKit, Error, TEXT("DesktopReadFile() ERROR: Unable to read file: %s"), *filePath);
         return false;
     }
 
-    return true;
-}
+    sizeRequest->WaitCompletion();
+    const int64 fileSize = sizeRequest->GetSizeResults();
+    sizeRequest.Reset();
+    if (fileSize < 0)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("DesktopReadFile() ERROR: Unable to read file: %s"), *filePath);
+        return false;
+    }
 
-int64 DefaultFileActions::getDesktopFileSize(const FString& filePath)
-{
-    if (!IFileManager::Get().FileExists(ToCStr(filePath)))
+    if (fileSize > size)
     {
-        return 0;
+        UE_LOG(LogAwsGameKit, Error, TEXT("DesktopReadFile() ERROR: File %s is %lld bytes, larger than the %lld byte buffer."), *filePath, fileSize, size);
+        return false;
     }
-    return IFileManager::Get().FileSize(ToCStr(filePath));
+
+    // The blocks are read straight into the caller's buffer. Requests must be destroyed before the file handle.
+    TArray<TUniquePtr<IAsyncReadRequest>> readRequests;
+    readRequests.Reserve((int32)((fileSize + ReadBlockSize - 1) / ReadBlockSize));
+    for (int64 offset = 0; offset < fileSize; offset += ReadBlockSize)
+    {
+        const int64 length = FMath::Min(ReadBlockSize, fileSize - offset);
+        readRequests.Emplace(fileHandle->ReadRequest(offset, length, AIOP_Normal, nullptr, data + offset));
+    }
+
+    bool bRead = true;
+    for (TUniquePtr<IAsyncReadRequest>& readRequest : readRequests)
+    {
+        if (!readRequest)
+        {
+            bRead = false;
+            continue;
+        }
+
+        readRequest->WaitCompletion();
+        bRead &= readRequest->GetReadResults() != nullptr;
+    }
+    readRequests.Empty();
+
+    if (!bRead)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("DesktopReadFile() ERROR: Unable to read file: %s"), *filePath);
+        return false;
+    }
+
+    return true;
 }
 
-bool DefaultFileActions::writeFileCallback(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath, const uint8_t* data, const unsigned int size)
+int64 DefaultFileActions::getDesktopFileSize(const FString& filePath)
 {
-    FString filePathFString(UTF8_TO_TCHAR(filePath));
-    return writeDesktopFile(filePathFString, TArray<uint8>(data, size));
+    recoverDesktopFile(filePath);
+
+    const int64 fileSize = IFileManager::Get().FileSize(ToCStr(filePath));
+    return fileSize < 0 ? 0 : fileSize;
 }
 
-bool DefaultFileActions::readFileCallback(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath, uint8_t* data, unsigned int size)
+bool DefaultFileActions::writeFileCallback(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath, const uint8_t* data, const unsigned int size)
 {
-    TArray<uint8> buffer;
     FString filePathFString(UTF8_TO_TCHAR(filePath));
-    bool result = readDesktopFile(filePathFString, buffer);
-    if (!result || size < (unsigned int)buffer.Num())
+    // Write straight from the library's buffer, save files can be large
+    const TArrayView<const uint8> fileData(data, size);
+    if (!writeDesktopFile(filePathFString, fileData))
     {
         return false;
     }
 
-    memcpy(data, buffer.GetData(), buffer.Num());
-
+    FAwsGameKitSaveInfoIndex::Get().Update(filePathFString, fileData);
     return true;
 }
 
+bool DefaultFileActions::readFileCallback(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath, uint8_t* data, unsigned int size)
+{
+    // Read straight into the library's buffer, save files can be large. Indexed SaveInfo.json files are already in memory.
+    FString filePathFString(UTF8_TO_TCHAR(filePath));
+    return FAwsGameKitSaveInfoIndex::Get().Read(filePathFString, data, size) || readDesktopFile(filePathFString, data, size);
+}
+
 unsigned int DefaultFileActions::getFileSizeCallback(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath)
 {
     FString filePathFString(UTF8_TO_TCHAR(filePath));
-    return getDesktopFileSize(filePathFString);
+    const int64 indexedSize = FAwsGameKitSaveInfoIndex::Get().GetSize(filePathFString);
+    const int64 fileSize = indexedSize != INDEX_NONE ? indexedSize : getDesktopFileSize(filePathFString);
+
+    // The library takes 32-bit sizes. Report a larger file as too large rather than truncating its size, so reading it fails instead of returning part of it.
+    if (fileSize > MAX_uint32)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("DesktopGetFileSize() ERROR: File %s is %lld bytes, larger than the Game Saving library supports."), *filePathFString, fileSize);
+        return MAX_uint32;
+    }
+
+    return (unsigned int)fileSize;
 }
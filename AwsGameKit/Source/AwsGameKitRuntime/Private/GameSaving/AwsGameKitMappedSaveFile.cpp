@@ -0,0 +1,49 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitMappedSaveFile.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+
+// Unreal
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+
+TUniquePtr<FAwsGameKitMappedSaveFile> FAwsGameKitMappedSaveFile::Open(const FString& FilePath)
+{
+    TUniquePtr<IMappedFileHandle> handle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+    if (!handle || handle->GetFileSize() <= 0 || handle->GetFileSize() > MAX_int32)
+    {
+        UE_LOG(LogAwsGameKit, Verbose, TEXT("FAwsGameKitMappedSaveFile::Open() Unable to map file: %s"), *FilePath);
+        return nullptr;
+    }
+
+    TUniquePtr<IMappedFileRegion> region(handle->MapRegion(0, handle->GetFileSize(), true));
+    if (!region)
+    {
+        UE_LOG(LogAwsGameKit, Verbose, TEXT("FAwsGameKitMappedSaveFile::Open() Unable to map file: %s"), *FilePath);
+        return nullptr;
+    }
+
+    return TUniquePtr<FAwsGameKitMappedSaveFile>(new FAwsGameKitMappedSaveFile(MoveTemp(handle), MoveTemp(region)));
+}
+
+FAwsGameKitMappedSaveFile::FAwsGameKitMappedSaveFile(TUniquePtr<IMappedFileHandle>&& Handle, TUniquePtr<IMappedFileRegion>&& Region) :
+    mappedHandle(MoveTemp(Handle)),
+    mappedRegion(MoveTemp(Region)),
+    data(mappedRegion->GetMappedPtr(), mappedRegion->GetMappedSize())
+{
+}
+
+FAwsGameKitMappedSaveFile::~FAwsGameKitMappedSaveFile()
+{
+    mappedRegion.Reset();
+    mappedHandle.Reset();
+}
+
+uint32 FAwsGameKitMappedSaveFile::GetCrc32() const
+{
+    return FCrc::MemCrc32(data.GetData(), data.Num());
+}
@@ -0,0 +1,85 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitSaveBufferPool.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+TAutoConsoleVariable<int32> CVarGameKitSaveBufferPoolMaxBuffers(
+    TEXT("GameKit.GameSaving.BufferPool.MaxBuffers"),
+    2,
+    TEXT("Maximum number of save file buffers kept by FAwsGameKitSaveBufferPool for reuse.\n")
+    TEXT(" 0: buffers are never kept\n"));
+
+TAutoConsoleVariable<int32> CVarGameKitSaveBufferPoolMaxMB(
+    TEXT("GameKit.GameSaving.BufferPool.MaxMB"),
+    256,
+    TEXT("Maximum total size in megabytes of the save file buffers kept by FAwsGameKitSaveBufferPool for reuse.\n"));
+
+FAwsGameKitSaveBufferPool& FAwsGameKitSaveBufferPool::Get()
+{
+    static FAwsGameKitSaveBufferPool Pool;
+    return Pool;
+}
+
+TArray<uint8> FAwsGameKitSaveBufferPool::Acquire(int32 Size)
+{
+    TArray<uint8> buffer;
+    {
+        FScopeLock scopeLock(&mutex);
+
+        int32 bestFit = INDEX_NONE;
+        for (int32 i = 0; i < buffers.Num(); ++i)
+        {
+            if (buffers[i].Max() >= Size && (bestFit == INDEX_NONE || buffers[i].Max() < buffers[bestFit].Max()))
+            {
+                bestFit = i;
+            }
+        }
+
+        if (bestFit != INDEX_NONE)
+        {
+            pooledBytes -= buffers[bestFit].Max();
+            buffer = MoveTemp(buffers[bestFit]);
+            buffers.RemoveAtSwap(bestFit, 1, false);
+        }
+    }
+
+    // Never shrink a reused buffer, it may be acquired for a larger save next time
+    buffer.SetNumUninitialized(Size, false);
+    return buffer;
+}
+
+void FAwsGameKitSaveBufferPool::Release(TArray<uint8>&& Buffer)
+{
+    const int64 capacity = Buffer.Max();
+    if (capacity == 0)
+    {
+        return;
+    }
+
+    const int64 maxBytes = (int64)CVarGameKitSaveBufferPoolMaxMB.GetValueOnAnyThread() * 1024 * 1024;
+
+    // Freed outside of the lock when it is not pooled
+    TArray<uint8> buffer = MoveTemp(Buffer);
+
+    FScopeLock scopeLock(&mutex);
+    if (buffers.Num() < CVarGameKitSaveBufferPoolMaxBuffers.GetValueOnAnyThread() && pooledBytes + capacity <= maxBytes)
+    {
+        buffer.Reset();
+        buffers.Add(MoveTemp(buffer));
+        pooledBytes += capacity;
+    }
+}
+
+void FAwsGameKitSaveBufferPool::Trim()
+{
+    TArray<TArray<uint8>> freed;
+    {
+        FScopeLock scopeLock(&mutex);
+        freed = MoveTemp(buffers);
+        pooledBytes = 0;
+    }
+}
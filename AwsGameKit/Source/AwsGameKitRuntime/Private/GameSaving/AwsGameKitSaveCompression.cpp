@@ -0,0 +1,289 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitSaveCompression.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+
+// Unreal
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// Standard Library
+#include <atomic>
+
+TAutoConsoleVariable<int32> CVarGameKitGameSavingCompressionChunkKB(
+    TEXT("GameKit.GameSaving.CompressionChunkKB"),
+    1024,
+    TEXT("Size in kilobytes of the chunks compressed save files are split into. Chunks are compressed and decompressed in parallel.\n"));
+
+namespace
+{
+    // "GKZ1"
+    constexpr uint32 CompressedSaveMagic = 0x315A4B47;
+
+    const FString MetadataTagPrefix = TEXT("[GameKitCompression:");
+    const FString MetadataTagSuffix = TEXT("]");
+
+    // Index of the suffix of the tag Metadata starts with, or INDEX_NONE if it has no tag
+    int32 FindMetadataTagEnd(const FString& Metadata)
+    {
+        if (!Metadata.StartsWith(MetadataTagPrefix, ESearchCase::CaseSensitive))
+        {
+            return INDEX_NONE;
+        }
+
+        return Metadata.Find(MetadataTagSuffix, ESearchCase::CaseSensitive, ESearchDir::FromStart, MetadataTagPrefix.Len());
+    }
+
+    struct FCompressedSaveHeader
+    {
+        FName FormatName;
+        int32 ChunkSize = 0;
+        int64 RawSize = 0;
+        TArray<int32> CompressedChunkSizes;
+
+        void Serialize(FArchive& Archive)
+        {
+            uint32 magic = CompressedSaveMagic;
+            Archive << magic;
+            if (magic != CompressedSaveMagic)
+            {
+                Archive.SetError();
+                return;
+            }
+
+            // The format name is stored as plain ANSI text so saves do not depend on the FName table
+            FString formatString = FormatName.ToString();
+            uint8 formatLength = (uint8)formatString.Len();
+            Archive << formatLength;
+            TArray<ANSICHAR> formatChars;
+            formatChars.SetNumZeroed(formatLength + 1);
+            if (Archive.IsSaving())
+            {
+                FMemory::Memcpy(formatChars.GetData(), TCHAR_TO_ANSI(*formatString), formatLength);
+            }
+            Archive.Serialize(formatChars.GetData(), formatLength);
+            if (Archive.IsLoading())
+            {
+                FormatName = FName(formatChars.GetData());
+            }
+
+            Archive << ChunkSize;
+            Archive << RawSize;
+
+            int32 chunkCount = CompressedChunkSizes.Num();
+            Archive << chunkCount;
+            if (Archive.IsLoading())
+            {
+                const int64 expectedChunks = ChunkSize > 0 ? (RawSize + ChunkSize - 1) / ChunkSize : -1;
+                if (RawSize < 0 || RawSize > MAX_int32 || chunkCount != expectedChunks || chunkCount > Archive.TotalSize() / (int64)sizeof(int32))
+                {
+                    Archive.SetError();
+                    return;
+                }
+                CompressedChunkSizes.SetNumUninitialized(chunkCount);
+            }
+            Archive.Serialize(CompressedChunkSizes.GetData(), chunkCount * sizeof(int32));
+            if (Archive.IsLoading() && !Archive.IsError())
+            {
+                // Every chunk holds at least one compressed byte, so a size of zero or less can only come from a corrupt header
+                for (const int32 compressedChunkSize : CompressedChunkSizes)
+                {
+                    if (compressedChunkSize <= 0)
+                    {
+                        Archive.SetError();
+                        return;
+                    }
+                }
+            }
+        }
+
+        static int64 GetSerializedSize(const FString& FormatString, int32 ChunkCount)
+        {
+            return sizeof(uint32) + sizeof(uint8) + FormatString.Len() + sizeof(int32) + sizeof(int64) + sizeof(int32) + (int64)ChunkCount * sizeof(int32);
+        }
+    };
+
+    int32 GetCompressionChunkSize()
+    {
+        return FMath::Max(CVarGameKitGameSavingCompressionChunkKB.GetValueOnAnyThread(), 4) * 1024;
+    }
+}
+
+bool FAwsGameKitSaveCompression::Compress(FName FormatName, TArrayView<const uint8> RawData, TArray<uint8>& OutCompressed)
+{
+    if (!FCompression::IsFormatValid(FormatName))
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitSaveCompression::Compress() Compression format %s is not available."), *FormatName.ToString());
+        return false;
+    }
+
+    const FString formatString = FormatName.ToString();
+    if (formatString.Len() > MAX_uint8)
+    {
+        return false;
+    }
+
+    FCompressedSaveHeader header;
+    header.FormatName = FormatName;
+    header.ChunkSize = GetCompressionChunkSize();
+    header.RawSize = RawData.Num();
+
+    const int32 chunkCount = (int32)((header.RawSize + header.ChunkSize - 1) / header.ChunkSize);
+    header.CompressedChunkSizes.SetNumZeroed(chunkCount);
+
+    // Every chunk is compressed in place at its worst case offset, then the chunks are moved together
+    TArray<int64> boundOffsets;
+    boundOffsets.SetNumUninitialized(chunkCount);
+    const int64 headerSize = FCompressedSaveHeader::GetSerializedSize(formatString, chunkCount);
+    int64 totalSize = headerSize;
+    for (int32 i = 0; i < chunkCount; ++i)
+    {
+        const int32 rawLength = (int32)FMath::Min<int64>(header.ChunkSize, header.RawSize - (int64)i * header.ChunkSize);
+        boundOffsets[i] = totalSize;
+        header.CompressedChunkSizes[i] = FCompression::CompressMemoryBound(FormatName, rawLength);
+        totalSize += header.CompressedChunkSizes[i];
+    }
+
+    if (totalSize > MAX_int32)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitSaveCompression::Compress() Save of %lld bytes is too large to compress."), header.RawSize);
+        return false;
+    }
+
+    OutCompressed.SetNumUninitialized((int32)totalSize);
+
+    std::atomic<bool> bFailed { false };
+    ParallelFor(chunkCount, [&](int32 Index)
+    {
+        const int64 rawOffset = (int64)Index * header.ChunkSize;
+        const int32 rawLength = (int32)FMath::Min<int64>(header.ChunkSize, header.RawSize - rawOffset);
+        if (!FCompression::CompressMemory(FormatName, OutCompressed.GetData() + boundOffsets[Index], header.CompressedChunkSizes[Index], RawData.GetData() + rawOffset, rawLength))
+        {
+            bFailed = true;
+        }
+    });
+
+    if (bFailed)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitSaveCompression::Compress() Compression with %s failed."), *formatString);
+        return false;
+    }
+
+    int64 writeOffset = headerSize;
+    for (int32 i = 0; i < chunkCount; ++i)
+    {
+        FMemory::Memmove(OutCompressed.GetData() + writeOffset, OutCompressed.GetData() + boundOffsets[i], header.CompressedChunkSizes[i]);
+        writeOffset += header.CompressedChunkSizes[i];
+    }
+    OutCompressed.SetNum((int32)writeOffset, false);
+
+    TArray<uint8> headerBytes;
+    FMemoryWriter writer(headerBytes);
+    header.Serialize(writer);
+    check(headerBytes.Num() == headerSize);
+    FMemory::Memcpy(OutCompressed.GetData(), headerBytes.GetData(), headerBytes.Num());
+
+    return true;
+}
+
+bool FAwsGameKitSaveCompression::Decompress(TArrayView<const uint8> Data, FName FormatName, int64 RawSize, TArray<uint8>& OutRaw)
+{
+    FMemoryReaderView reader(Data);
+    FCompressedSaveHeader header;
+    header.Serialize(reader);
+    if (reader.IsError())
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitSaveCompression::Decompress() The save file is not compressed or is corrupt."));
+        return false;
+    }
+
+    if (header.FormatName != FormatName || header.RawSize != RawSize)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitSaveCompression::Decompress() The save file header (%s, %lld bytes) does not match its metadata (%s, %lld bytes)."),
+            *header.FormatName.ToString(), header.RawSize, *FormatName.ToString(), RawSize);
+        return false;
+    }
+
+    const int32 chunkCount = header.CompressedChunkSizes.Num();
+    TArray<int64> compressedOffsets;
+    compressedOffsets.SetNumUninitialized(chunkCount);
+    int64 offset = reader.Tell();
+    for (int32 i = 0; i < chunkCount && offset <= Data.Num(); ++i)
+    {
+        compressedOffsets[i] = offset;
+        offset += header.CompressedChunkSizes[i];
+    }
+
+    // Chunk sizes are positive, so stopping once the offset passes the end keeps it from overflowing on a corrupt header
+    if (offset != Data.Num())
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitSaveCompression::Decompress() The save file is truncated or corrupt."));
+        return false;
+    }
+
+    OutRaw.SetNumUninitialized((int32)header.RawSize);
+
+    std::atomic<bool> bFailed { false };
+    ParallelFor(chunkCount, [&](int32 Index)
+    {
+        const int64 rawOffset = (int64)Index * header.ChunkSize;
+        const int32 rawLength = (int32)FMath::Min<int64>(header.ChunkSize, header.RawSize - rawOffset);
+        if (!FCompression::UncompressMemory(header.FormatName, OutRaw.GetData() + rawOffset, rawLength, Data.GetData() + compressedOffsets[Index], header.CompressedChunkSizes[Index]))
+        {
+            bFailed = true;
+        }
+    });
+
+    if (bFailed)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitSaveCompression::Decompress() Decompression with %s failed."), *header.FormatName.ToString());
+        OutRaw.Reset();
+        return false;
+    }
+
+    return true;
+}
+
+FString FAwsGameKitSaveCompression::TagMetadata(const FString& Metadata, FName FormatName, int64 RawSize)
+{
+    return FString::Printf(TEXT("%s%s:%lld%s%s"), *MetadataTagPrefix, *FormatName.ToString(), RawSize, *MetadataTagSuffix, *Metadata);
+}
+
+bool FAwsGameKitSaveCompression::ReadMetadataTag(const FString& Metadata, FName& OutFormatName, int64& OutRawSize)
+{
+    const int32 suffixIndex = FindMetadataTagEnd(Metadata);
+    if (suffixIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // "<format>:<raw size>"
+    const FString tag = Metadata.Mid(MetadataTagPrefix.Len(), suffixIndex - MetadataTagPrefix.Len());
+    FString formatString;
+    FString rawSizeString;
+    if (!tag.Split(TEXT(":"), &formatString, &rawSizeString))
+    {
+        return false;
+    }
+
+    OutFormatName = FName(*formatString);
+    OutRawSize = FCString::Atoi64(*rawSizeString);
+    return true;
+}
+
+FString FAwsGameKitSaveCompression::UntagMetadata(const FString& Metadata, int64& OutRawSize)
+{
+    FName formatName;
+    if (!ReadMetadataTag(Metadata, formatName, OutRawSize))
+    {
+        return Metadata;
+    }
+
+    return Metadata.RightChop(FindMetadataTagEnd(Metadata) + MetadataTagSuffix.Len());
+}
@@ -0,0 +1,75 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitSaveDigest.h"
+
+// GameKit
+#include "GameSaving/AwsGameKitSaveCompression.h"
+
+// Unreal
+#include "Misc/SecureHash.h"
+
+namespace
+{
+    const FString MetadataTagPrefix = TEXT("[GameKitDigest:");
+    const FString MetadataTagSuffix = TEXT("]");
+
+    // Index of the suffix of the tag Metadata starts with, or INDEX_NONE if it has no tag
+    int32 FindMetadataTagEnd(const FString& Metadata)
+    {
+        if (!Metadata.StartsWith(MetadataTagPrefix, ESearchCase::CaseSensitive))
+        {
+            return INDEX_NONE;
+        }
+
+        return Metadata.Find(MetadataTagSuffix, ESearchCase::CaseSensitive, ESearchDir::FromStart, MetadataTagPrefix.Len());
+    }
+}
+
+FString FAwsGameKitSaveDigest::Compute(TArrayView<const uint8> RawData, const FString& Metadata, int64 EpochTime, FName CompressionFormat)
+{
+    FSHA1 sha;
+
+    // The size goes first so the save bytes and the text after them cannot run into each other
+    int64 rawSize = RawData.Num();
+    sha.Update(reinterpret_cast<const uint8*>(&rawSize), sizeof(rawSize));
+    sha.Update(RawData.GetData(), RawData.Num());
+
+    const FString fields = FString::Printf(TEXT("%lld:%s:%s"), EpochTime, *CompressionFormat.ToString(), *Metadata);
+    const FTCHARToUTF8 utf8Fields(*fields);
+    sha.Update(reinterpret_cast<const uint8*>(utf8Fields.Get()), utf8Fields.Length());
+
+    sha.Final();
+    uint8 hash[FSHA1::DigestSize];
+    sha.GetHash(hash);
+    return BytesToHex(hash, FSHA1::DigestSize);
+}
+
+FString FAwsGameKitSaveDigest::TagMetadata(const FString& Metadata, const FString& Digest)
+{
+    return MetadataTagPrefix + Digest + MetadataTagSuffix + Metadata;
+}
+
+FString FAwsGameKitSaveDigest::ReadMetadataTag(const FString& Metadata)
+{
+    int64 rawSize = 0;
+    const FString untagged = FAwsGameKitSaveCompression::UntagMetadata(Metadata, rawSize);
+    const int32 suffixIndex = FindMetadataTagEnd(untagged);
+    if (suffixIndex == INDEX_NONE)
+    {
+        return FString();
+    }
+
+    return untagged.Mid(MetadataTagPrefix.Len(), suffixIndex - MetadataTagPrefix.Len());
+}
+
+FString FAwsGameKitSaveDigest::UntagMetadata(const FString& Metadata)
+{
+    const int32 suffixIndex = FindMetadataTagEnd(Metadata);
+    if (suffixIndex == INDEX_NONE)
+    {
+        return Metadata;
+    }
+
+    return Metadata.RightChop(suffixIndex + MetadataTagSuffix.Len());
+}
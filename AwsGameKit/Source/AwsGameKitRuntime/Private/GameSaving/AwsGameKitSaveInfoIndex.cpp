@@ -0,0 +1,301 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitSaveInfoIndex.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "GameSaving/AwsGameKitGameSavingWrapper.h"
+
+// Unreal
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Templates/UniquePtr.h"
+
+namespace
+{
+    // "GKI1"
+    constexpr uint32 SaveInfoIndexMagic = 0x31494B47;
+
+    enum class ERecordType : uint8
+    {
+        Put = 0,
+        Remove = 1
+    };
+
+    // Byte arrays are length prefixed
+    void WriteBytes(FArchive& Archive, const uint8* Bytes, int32 Size)
+    {
+        Archive << Size;
+        Archive.Serialize(const_cast<uint8*>(Bytes), Size);
+    }
+
+    // The length is checked before anything is allocated, so a corrupt index can't request a huge buffer
+    bool ReadBytes(FArchive& Archive, TArray<uint8>& Bytes)
+    {
+        int32 size = 0;
+        Archive << size;
+        if (Archive.IsError() || size < 0 || size > Archive.TotalSize() - Archive.Tell())
+        {
+            Archive.SetError();
+            return false;
+        }
+
+        Bytes.SetNumUninitialized(size);
+        Archive.Serialize(Bytes.GetData(), size);
+        return !Archive.IsError();
+    }
+
+    void WriteRecord(FArchive& Archive, ERecordType Type, const FString& FileName, const FDateTime& Timestamp = FDateTime(), const TArray<uint8>& Contents = TArray<uint8>())
+    {
+        const FTCHARToUTF8 utf8FileName(*FileName);
+
+        uint8 type = (uint8)Type;
+        Archive << type;
+        WriteBytes(Archive, (const uint8*)utf8FileName.Get(), utf8FileName.Length());
+        if (Type == ERecordType::Put)
+        {
+            int64 ticks = Timestamp.GetTicks();
+            Archive << ticks;
+            WriteBytes(Archive, Contents.GetData(), Contents.Num());
+        }
+    }
+
+    bool IsSaveInfoFile(const FString& FilePath)
+    {
+        return FilePath.EndsWith(UTF8_TO_TCHAR(GameKit::GameSaving::Wrapper::SaveInfoFileExtension));
+    }
+}
+
+FAwsGameKitSaveInfoIndex& FAwsGameKitSaveInfoIndex::Get()
+{
+    static FAwsGameKitSaveInfoIndex Index;
+    return Index;
+}
+
+FString FAwsGameKitSaveInfoIndex::GetIndexPath(const FString& Directory)
+{
+    return FPaths::Combine(Directory, TEXT("SaveInfoIndex.bin"));
+}
+
+TArray<FString> FAwsGameKitSaveInfoIndex::LoadDirectory(const FString& Directory)
+{
+    const FString fullDirectory = FPaths::ConvertRelativePathToFull(Directory);
+
+    FScopeLock scopeLock(&mutex);
+    FDirectoryIndex& index = directories.FindOrAdd(fullDirectory);
+    index.Reset();
+
+    // Replay the index. A record torn by a crash ends the replay, the files it described are re-read below.
+    bool bCompact = true;
+    TArray<uint8> bytes;
+    if (FFileHelper::LoadFileToArray(bytes, *GetIndexPath(fullDirectory), FILEREAD_Silent))
+    {
+        FMemoryReader reader(bytes);
+        uint32 magic = 0;
+        reader << magic;
+
+        int32 recordCount = 0;
+        while (!reader.IsError() && magic == SaveInfoIndexMagic && !reader.AtEnd())
+        {
+            uint8 type = 0;
+            TArray<uint8> fileNameBytes;
+            reader << type;
+            if (!ReadBytes(reader, fileNameBytes))
+            {
+                break;
+            }
+
+            const FUTF8ToTCHAR utf8FileName((const ANSICHAR*)fileNameBytes.GetData(), fileNameBytes.Num());
+            const FString fileName(utf8FileName.Length(), utf8FileName.Get());
+            if (type == (uint8)ERecordType::Put)
+            {
+                int64 ticks = 0;
+                FEntry entry;
+                reader << ticks;
+                if (!ReadBytes(reader, entry.Contents))
+                {
+                    break;
+                }
+
+                entry.Timestamp = FDateTime(ticks);
+                index.Add(fileName, MoveTemp(entry));
+            }
+            else if (type == (uint8)ERecordType::Remove)
+            {
+                index.Remove(fileName);
+            }
+            else
+            {
+                reader.SetError();
+                break;
+            }
+            recordCount++;
+        }
+
+        // Compact once records were superseded or the index is damaged
+        bCompact = reader.IsError() || magic != SaveInfoIndexMagic || recordCount != index.Num();
+    }
+
+    // One listing of the directory validates every entry by its modification time
+    TMap<FString, FFileStatData> files;
+    FPlatformFileManager::Get().GetPlatformFile().IterateDirectoryStat(*fullDirectory, [&files](const TCHAR* Path, const FFileStatData& StatData)
+    {
+        const FString path(Path);
+        if (!StatData.bIsDirectory && IsSaveInfoFile(path))
+        {
+            files.Add(FPaths::GetCleanFilename(path), StatData);
+        }
+        return true;
+    });
+
+    for (auto it = index.CreateIterator(); it; ++it)
+    {
+        if (!files.Contains(it.Key()))
+        {
+            it.RemoveCurrent();
+            bCompact = true;
+        }
+    }
+
+    TArray<FString> filePaths;
+    filePaths.Reserve(files.Num());
+    for (const TPair<FString, FFileStatData>& file : files)
+    {
+        const FString filePath = FPaths::Combine(fullDirectory, file.Key);
+        filePaths.Add(filePath);
+
+        const FEntry* entry = index.Find(file.Key);
+        if (entry != nullptr && entry->Timestamp == file.Value.ModificationTime && entry->Contents.Num() == file.Value.FileSize)
+        {
+            continue;
+        }
+
+        FEntry& changedEntry = index.FindOrAdd(file.Key);
+        changedEntry.Timestamp = file.Value.ModificationTime;
+        if (!FFileHelper::LoadFileToArray(changedEntry.Contents, *filePath))
+        {
+            index.Remove(file.Key);
+        }
+        bCompact = true;
+    }
+
+    UE_LOG(LogAwsGameKit, Verbose, TEXT("FAwsGameKitSaveInfoIndex::LoadDirectory() Indexed %d SaveInfo files in %s."), index.Num(), *fullDirectory);
+
+    if (bCompact && !WriteIndex(fullDirectory, index))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitSaveInfoIndex::LoadDirectory() Unable to write %s"), *GetIndexPath(fullDirectory));
+    }
+
+    return filePaths;
+}
+
+void FAwsGameKitSaveInfoIndex::Update(const FString& FilePath, TArrayView<const uint8> Contents)
+{
+    if (!IsSaveInfoFile(FilePath))
+    {
+        return;
+    }
+
+    FScopeLock scopeLock(&mutex);
+    FString directory;
+    FString fileName;
+    FDirectoryIndex* index = FindDirectory(FilePath, directory, fileName);
+    if (index == nullptr)
+    {
+        return;
+    }
+
+    FEntry& entry = index->FindOrAdd(fileName);
+    entry.Timestamp = IFileManager::Get().GetTimeStamp(*FilePath);
+    entry.Contents = TArray<uint8>(Contents.GetData(), Contents.Num());
+
+    TArray<uint8> record;
+    FMemoryWriter writer(record);
+    WriteRecord(writer, ERecordType::Put, fileName, entry.Timestamp, entry.Contents);
+    AppendRecord(directory, record);
+}
+
+void FAwsGameKitSaveInfoIndex::Remove(const FString& FilePath)
+{
+    FScopeLock scopeLock(&mutex);
+    FString directory;
+    FString fileName;
+    FDirectoryIndex* index = FindDirectory(FilePath, directory, fileName);
+    if (index == nullptr || index->Remove(fileName) == 0)
+    {
+        return;
+    }
+
+    TArray<uint8> record;
+    FMemoryWriter writer(record);
+    WriteRecord(writer, ERecordType::Remove, fileName);
+    AppendRecord(directory, record);
+}
+
+int64 FAwsGameKitSaveInfoIndex::GetSize(const FString& FilePath)
+{
+    FScopeLock scopeLock(&mutex);
+    FString directory;
+    FString fileName;
+    FDirectoryIndex* index = FindDirectory(FilePath, directory, fileName);
+    const FEntry* entry = index != nullptr ? index->Find(fileName) : nullptr;
+    return entry != nullptr ? entry->Contents.Num() : INDEX_NONE;
+}
+
+bool FAwsGameKitSaveInfoIndex::Read(const FString& FilePath, uint8* Data, int64 Size)
+{
+    FScopeLock scopeLock(&mutex);
+    FString directory;
+    FString fileName;
+    FDirectoryIndex* index = FindDirectory(FilePath, directory, fileName);
+    const FEntry* entry = index != nullptr ? index->Find(fileName) : nullptr;
+    if (entry == nullptr || entry->Contents.Num() > Size)
+    {
+        return false;
+    }
+
+    FMemory::Memcpy(Data, entry->Contents.GetData(), entry->Contents.Num());
+    return true;
+}
+
+FAwsGameKitSaveInfoIndex::FDirectoryIndex* FAwsGameKitSaveInfoIndex::FindDirectory(const FString& FilePath, FString& OutDirectory, FString& OutFileName)
+{
+    if (directories.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    const FString fullPath = FPaths::ConvertRelativePathToFull(FilePath);
+    OutDirectory = FPaths::GetPath(fullPath);
+    OutFileName = FPaths::GetCleanFilename(fullPath);
+    return directories.Find(OutDirectory);
+}
+
+bool FAwsGameKitSaveInfoIndex::WriteIndex(const FString& Directory, const FDirectoryIndex& Index)
+{
+    TArray<uint8> bytes;
+    FMemoryWriter writer(bytes);
+    uint32 magic = SaveInfoIndexMagic;
+    writer << magic;
+    for (const TPair<FString, FEntry>& entry : Index)
+    {
+        WriteRecord(writer, ERecordType::Put, entry.Key, entry.Value.Timestamp, entry.Value.Contents);
+    }
+
+    return FFileHelper::SaveArrayToFile(bytes, *GetIndexPath(Directory));
+}
+
+void FAwsGameKitSaveInfoIndex::AppendRecord(const FString& Directory, const TArray<uint8>& Record)
+{
+    TUniquePtr<IFileHandle> fileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*GetIndexPath(Directory), true));
+    if (!fileHandle || !fileHandle->Write(Record.GetData(), Record.Num()))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitSaveInfoIndex::AppendRecord() Unable to update %s, it is rebuilt the next time it is loaded."), *GetIndexPath(Directory));
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitSlotCache.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+
+TAutoConsoleVariable<bool> CVarGameKitGameSavingSlimResults(
+    TEXT("GameKit.GameSaving.SlimResults"),
+    false,
+    TEXT("If true, the results of AwsGameKitGameSaving calls that act on a single slot only contain that slot, not a copy of every cached slot.\n")
+    TEXT("Read the full set of slots from FAwsGameKitSlotCache instead.\n"));
+
+namespace
+{
+    bool IsSameSlot(const FGameSavingSlot& A, const FGameSavingSlot& B)
+    {
+        return A.SizeLocal == B.SizeLocal
+            && A.SizeCloud == B.SizeCloud
+            && A.SizeLocalRaw == B.SizeLocalRaw
+            && A.SizeCloudRaw == B.SizeCloudRaw
+            && A.LastModifiedLocal == B.LastModifiedLocal
+            && A.LastModifiedCloud == B.LastModifiedCloud
+            && A.LastSync == B.LastSync
+            && A.SlotSyncStatus == B.SlotSyncStatus
+            && A.MetadataLocal == B.MetadataLocal
+            && A.MetadataCloud == B.MetadataCloud;
+    }
+}
+
+FAwsGameKitSlotCache& FAwsGameKitSlotCache::Get()
+{
+    check(IsInGameThread());
+
+    static FAwsGameKitSlotCache Cache;
+    return Cache;
+}
+
+bool FAwsGameKitSlotCache::IsSlimResultsEnabled()
+{
+    return CVarGameKitGameSavingSlimResults.GetValueOnAnyThread();
+}
+
+const FGameSavingSlot* FAwsGameKitSlotCache::Find(const FString& SlotName) const
+{
+    return slots.Find(SlotName);
+}
+
+const TMap<FString, FGameSavingSlot>& FAwsGameKitSlotCache::GetSlots() const
+{
+    return slots;
+}
+
+int64 FAwsGameKitSlotCache::GetVersion() const
+{
+    return version;
+}
+
+int64 FAwsGameKitSlotCache::Update(const FGameSavingSlot& Slot)
+{
+    if (Slot.SlotName.IsEmpty())
+    {
+        return version;
+    }
+
+    FGameSavingSlot* cachedSlot = slots.Find(Slot.SlotName);
+    if (cachedSlot == nullptr)
+    {
+        slots.Add(Slot.SlotName, Slot);
+        return ++version;
+    }
+
+    if (IsSameSlot(*cachedSlot, Slot))
+    {
+        return version;
+    }
+
+    *cachedSlot = Slot;
+    return ++version;
+}
+
+int64 FAwsGameKitSlotCache::Remove(const FString& SlotName)
+{
+    return slots.Remove(SlotName) > 0 ? ++version : version;
+}
+
+int64 FAwsGameKitSlotCache::Reset(const TArray<FGameSavingSlot>& Slots)
+{
+    slots.Reset();
+    slots.Reserve(Slots.Num());
+    for (const FGameSavingSlot& slot : Slots)
+    {
+        slots.Add(slot.SlotName, slot);
+    }
+
+    return ++version;
+}
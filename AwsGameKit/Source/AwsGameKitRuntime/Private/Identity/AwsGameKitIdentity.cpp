@@ -8,25 +8,23 @@
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimeInternalHelpers.h"
 #include "AwsGameKitRuntimePublicHelpers.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBuffer.h"
 
 // Unreal
 #include "Async/Async.h"
 #include "Templates/Function.h"
 
-IdentityLibrary AwsGameKitIdentity::GetIdentityLibraryFromModule()
+const IdentityLibrary& AwsGameKitIdentity::GetIdentityLibraryFromModule()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitIdentity::GetIdentityLibraryFromModule()"));
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    return runtimeModule->GetIdentityLibrary();
+    return FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
 }
 
-void AwsGameKitIdentity::Register(const FUserRegistrationRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::Register(const FUserRegistrationRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.Register"), [=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
-
-        FGraphEventRef OrderedWorkChain;
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         FAwsGameKitInternalTempStrings ConvertString;
         UserRegistration wrapperArgs
@@ -39,17 +37,16 @@ void AwsGameKitIdentity::Register(const FUserRegistrationRequest& Request, FAwsG
         };
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityRegister(identityLibrary.IdentityInstanceHandle, wrapperArgs));
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitIdentity::ConfirmRegistration(const FConfirmRegistrationRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::ConfirmRegistration(const FConfirmRegistrationRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.ConfirmRegistration"), [=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
-        FGraphEventRef OrderedWorkChain;
         FAwsGameKitInternalTempStrings ConvertString;
         ConfirmRegistrationRequest wrapperArgs
         {
@@ -58,17 +55,16 @@ void AwsGameKitIdentity::ConfirmRegistration(const FConfirmRegistrationRequest&
         };
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityConfirmRegistration(identityLibrary.IdentityInstanceHandle, wrapperArgs));
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitIdentity::ResendConfirmationCode(const FResendConfirmationCodeRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::ResendConfirmationCode(const FResendConfirmationCodeRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.ResendConfirmationCode"), [=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
-        FGraphEventRef OrderedWorkChain;
         FAwsGameKitInternalTempStrings ConvertString;
         ResendConfirmationCodeRequest wrapperArgs
         {
@@ -76,17 +72,16 @@ void AwsGameKitIdentity::ResendConfirmationCode(const FResendConfirmationCodeReq
         };
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityResendConfirmationCode(identityLibrary.IdentityInstanceHandle, wrapperArgs));
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitIdentity::ForgotPassword(const FForgotPasswordRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::ForgotPassword(const FForgotPasswordRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.ForgotPassword"), [=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
-        FGraphEventRef OrderedWorkChain;
         FAwsGameKitInternalTempStrings ConvertString;
         ForgotPasswordRequest wrapperArgs
         {
@@ -94,17 +89,16 @@ void AwsGameKitIdentity::ForgotPassword(const FForgotPasswordRequest& Request, F
         };
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityForgotPassword(identityLibrary.IdentityInstanceHandle, wrapperArgs));
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitIdentity::ConfirmForgotPassword(const FConfirmForgotPasswordRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::ConfirmForgotPassword(const FConfirmForgotPasswordRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.ConfirmForgotPassword"), [=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
-        FGraphEventRef OrderedWorkChain;
         FAwsGameKitInternalTempStrings ConvertString;
         ConfirmForgotPasswordRequest wrapperArgs
         {
@@ -114,16 +108,15 @@ void AwsGameKitIdentity::ConfirmForgotPassword(const FConfirmForgotPasswordReque
         };
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityConfirmForgotPassword(identityLibrary.IdentityInstanceHandle, wrapperArgs));
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitIdentity::GetFederatedLoginUrl(const FederatedIdentityProvider_E& IdentityProvider, TAwsGameKitDelegateParam<const IntResult&, const FLoginUrlResponse&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::GetFederatedLoginUrl(const FederatedIdentityProvider_E& IdentityProvider, TAwsGameKitDelegateParam<const IntResult&, const FLoginUrlResponse&> ResultDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.GetFederatedLoginUrl"), [=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         TMap<FString, FString> loginUrlInfo;
         auto loginUrlInfoSetter = [&loginUrlInfo](const char* key, const char* value)
@@ -141,29 +134,27 @@ void AwsGameKitIdentity::GetFederatedLoginUrl(const FederatedIdentityProvider_E&
         const FString requestId = loginUrlInfo.FindRef(AwsGameKitIdentityWrapper::KEY_FEDERATED_LOGIN_URL_REQUEST_ID);
         const FString loginUrl = loginUrlInfo.FindRef(AwsGameKitIdentityWrapper::KEY_FEDERATED_LOGIN_URL);
         const FLoginUrlResponse loginUrlResponse = FLoginUrlResponse{ *requestId, *loginUrl };
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, loginUrlResponse);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, loginUrlResponse);
     });
 }
 
-void AwsGameKitIdentity::PollAndRetrieveFederatedTokens(const FPollAndRetrieveFederatedTokensRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FederatedIdentityProvider_E&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::PollAndRetrieveFederatedTokens(const FPollAndRetrieveFederatedTokensRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FederatedIdentityProvider_E&> ResultDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.PollAndRetrieveFederatedTokens"), [=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
-        FGraphEventRef OrderedWorkChain;
         IntResult result(identityLibrary.IdentityWrapper->GameKitPollAndRetrieveFederatedTokens(identityLibrary.IdentityInstanceHandle, AwsGameKitIdentityTypeConverter::ConvertProviderEnum(Request.IdentityProvider), TCHAR_TO_UTF8(*Request.RequestId), Request.Timeout));
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, Request.IdentityProvider);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, Request.IdentityProvider);
     });
 }
 
-void AwsGameKitIdentity::GetFederatedIdToken(const FederatedIdentityProvider_E& IdentityProvider, TAwsGameKitDelegateParam<const IntResult&, const FString&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::GetFederatedIdToken(const FederatedIdentityProvider_E& IdentityProvider, TAwsGameKitDelegateParam<const IntResult&, const FString&> ResultDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.GetFederatedIdToken"), [=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
-        FGraphEventRef OrderedWorkChain;
         FString accessToken;
         auto getUserInfoDispatcher = [&](const char* response)
         {
@@ -171,17 +162,16 @@ void AwsGameKitIdentity::GetFederatedIdToken(const FederatedIdentityProvider_E&
         };
         typedef LambdaDispatcher<decltype(getUserInfoDispatcher), void, const char*> GetUserInfoDispatcher;
         IntResult result(identityLibrary.IdentityWrapper->GameKitGetFederatedIdToken(identityLibrary.IdentityInstanceHandle, AwsGameKitIdentityTypeConverter::ConvertProviderEnum(IdentityProvider), &getUserInfoDispatcher, GetUserInfoDispatcher::Dispatch));
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, accessToken);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, accessToken);
     });
 }
 
-void AwsGameKitIdentity::Login(const FUserLoginRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::Login(const FUserLoginRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.Login"), [=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
-        FGraphEventRef OrderedWorkChain;
         FAwsGameKitInternalTempStrings ConvertString;
         UserLogin wrapperArgs
         {
@@ -190,29 +180,31 @@ void AwsGameKitIdentity::Login(const FUserLoginRequest& Request, FAwsGameKitStat
         };
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityLogin(identityLibrary.IdentityInstanceHandle, wrapperArgs));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitIdentity::Logout(FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::Logout(FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    // The cached bundles and buffered writes belong to the player who is logging out. Clear them here, before the call can be cancelled or fail.
+    FAwsGameKitUserGameplayDataCache::Get().ClearPlayerData();
+    FAwsGameKitUserGameplayDataWriteBuffer::Get().DiscardPlayerWrites();
+
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.Logout"), [=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
-        FGraphEventRef OrderedWorkChain;
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityLogout(identityLibrary.IdentityInstanceHandle));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitIdentity::GetUser(TAwsGameKitDelegateParam<const IntResult&, const FGetUserResponse&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitIdentity::GetUser(TAwsGameKitDelegateParam<const IntResult&, const FGetUserResponse&> ResultDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::Identity, TEXT("Identity.GetUser"), [=]
     {
-        FGraphEventRef OrderedWorkChain;
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         FString userInfo;
         FGetUserResponse response;
@@ -231,6 +223,6 @@ void AwsGameKitIdentity::GetUser(TAwsGameKitDelegateParam<const IntResult&, cons
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityGetUser(identityLibrary.IdentityInstanceHandle, &getUserInfoDispatcher, GetUserInfoDispatcher::Dispatch));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, response);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, response);
     });
 }
@@ -9,6 +9,8 @@
 #include "AwsGameKitRuntimeInternalHelpers.h"
 #include "Core/AwsGameKitDispatcher.h"
 #include "Core/AwsGameKitErrors.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBuffer.h"
 
 // Unreal
 #include "LatentActions.h"
@@ -31,8 +33,7 @@ void UAwsGameKitIdentityFunctionLibrary::Register(
     {
         Action->LaunchThreadedWork([Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             UserRegistration wrapperArgs
             {
@@ -62,8 +63,7 @@ void UAwsGameKitIdentityFunctionLibrary::ConfirmRegistration(UObject* WorldConte
     {
         Action->LaunchThreadedWork([Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             ConfirmRegistrationRequest wrapperArgs
             {
@@ -90,8 +90,7 @@ void UAwsGameKitIdentityFunctionLibrary::ResendConfirmationCode(UObject* WorldCo
     {
         Action->LaunchThreadedWork([Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             ResendConfirmationCodeRequest wrapperArgs
             {
@@ -117,8 +116,7 @@ void UAwsGameKitIdentityFunctionLibrary::ForgotPassword(UObject* WorldContextObj
     {
         Action->LaunchThreadedWork([Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             ForgotPasswordRequest wrapperArgs
             {
@@ -144,8 +142,7 @@ void UAwsGameKitIdentityFunctionLibrary::ConfirmForgotPassword(UObject* WorldCon
     {
         Action->LaunchThreadedWork([Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             ConfirmForgotPasswordRequest wrapperArgs
             {
@@ -174,8 +171,7 @@ void UAwsGameKitIdentityFunctionLibrary::GetFederatedLoginUrl(UObject* WorldCont
     {
         Action->LaunchThreadedWork([IdentityProvider, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
 
             TMap<FString, FString> loginUrlInfo;
             auto loginUrlInfoSetter = [&loginUrlInfo](const char* key, const char* value)
@@ -214,8 +210,7 @@ void UAwsGameKitIdentityFunctionLibrary::PollAndRetrieveFederatedTokens(UObject*
     {
         Action->LaunchThreadedWork([Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
 
             IntResult result(identityLibrary.IdentityWrapper->GameKitPollAndRetrieveFederatedTokens(
                 identityLibrary.IdentityInstanceHandle,
@@ -242,8 +237,7 @@ void UAwsGameKitIdentityFunctionLibrary::GetFederatedIdToken(UObject* WorldConte
     {
         Action->LaunchThreadedWork([IdentityProvider, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
 
             FString accessToken;
             auto getUserInfoDispatcher = [&](const char* response)
@@ -276,8 +270,7 @@ void UAwsGameKitIdentityFunctionLibrary::Login(UObject* WorldContextObject,
     {
         Action->LaunchThreadedWork([Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             UserLogin wrapperArgs
             {
@@ -298,13 +291,16 @@ void UAwsGameKitIdentityFunctionLibrary::Logout(UObject* WorldContextObject,
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::Logout()"));
 
+    // The cached bundles and buffered writes belong to the player who is logging out. Clear them here, before the action can be abandoned or fail.
+    FAwsGameKitUserGameplayDataCache::Get().ClearPlayerData();
+    FAwsGameKitUserGameplayDataWriteBuffer::Get().DiscardPlayerWrites();
+
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error))
     {
         Action->LaunchThreadedWork([State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
 
             IntResult result = IntResult(identityLibrary.IdentityWrapper->GameKitIdentityLogout(identityLibrary.IdentityInstanceHandle));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
@@ -325,8 +321,7 @@ void UAwsGameKitIdentityFunctionLibrary::GetUser(UObject* WorldContextObject,
     {
         Action->LaunchThreadedWork([State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
 
             auto getUserInfoDispatcher = [&](const GetUserResponse* getUserResponse)
             {
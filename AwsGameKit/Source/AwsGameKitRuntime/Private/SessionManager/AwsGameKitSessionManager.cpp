@@ -6,34 +6,38 @@
 // GameKit
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitCore.h"
+#include "Common/AwsGameKitApiStats.h"
 #include "Models/AwsGameKitEnumConverter.h"
 
 // Unreal
 #include "Async/Async.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Templates/Function.h"
 
-SessionManagerLibrary AwsGameKitSessionManager::GetSessionManagerLibraryFromModule()
+const SessionManagerLibrary& AwsGameKitSessionManager::GetSessionManagerLibraryFromModule()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitIdentity::GetIdentityLibraryFromModule()"));
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    return runtimeModule->GetSessionManagerLibrary();
+    return FAwsGameKitRuntimeModule::Get().GetSessionManagerLibrary();
 }
 
 void AwsGameKitSessionManager::ReloadConfig()
 {
-    SessionManagerLibrary sessionManagerLibrary = GetSessionManagerLibraryFromModule();
+    TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(TEXT("SessionManager.ReloadConfig"));
+    FAwsGameKitApiScope ApiScope(TEXT("SessionManager.ReloadConfig"));
+    const SessionManagerLibrary& sessionManagerLibrary = GetSessionManagerLibraryFromModule();
     sessionManagerLibrary.SessionManagerWrapper->ReloadConfig(sessionManagerLibrary.SessionManagerInstanceHandle);
 }
 
 bool AwsGameKitSessionManager::AreSettingsLoaded(FeatureType_E featureType)
 {
-    SessionManagerLibrary sessionManagerLibrary = GetSessionManagerLibraryFromModule();
+    const SessionManagerLibrary& sessionManagerLibrary = GetSessionManagerLibraryFromModule();
     return sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerAreSettingsLoaded(sessionManagerLibrary.SessionManagerInstanceHandle, AwsGameKitEnumConverter::ConvertFeatureEnum(featureType));
 }
 
 void AwsGameKitSessionManager::SetToken(TokenType_E tokenType, FString value)
 {
-    SessionManagerLibrary sessionManagerLibrary = GetSessionManagerLibraryFromModule();
+    TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(TEXT("SessionManager.SetToken"));
+    FAwsGameKitApiScope ApiScope(TEXT("SessionManager.SetToken"));
+    const SessionManagerLibrary& sessionManagerLibrary = GetSessionManagerLibraryFromModule();
     sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerSetToken(sessionManagerLibrary.SessionManagerInstanceHandle, AwsGameKitEnumConverter::ConvertTokenTypeEnum(tokenType), TCHAR_TO_UTF8(*value));
 }
 
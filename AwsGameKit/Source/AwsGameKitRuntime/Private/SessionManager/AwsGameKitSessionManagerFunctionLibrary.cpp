@@ -28,8 +28,7 @@ void UAwsGameKitSessionManagerFunctionLibrary::ReloadConfig(UObject* WorldContex
     {
         Action->LaunchThreadedWork([State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            SessionManagerLibrary sessionManagerLibrary = runtimeModule->GetSessionManagerLibrary();
+            const SessionManagerLibrary& sessionManagerLibrary = FAwsGameKitRuntimeModule::Get().GetSessionManagerLibrary();
 
 #if WITH_EDITOR
             // This call is only needed in Editor mode. Packaged builds will load the configuration when the FAwsGameKitRuntimeModule module is loaded.
@@ -47,8 +46,7 @@ bool UAwsGameKitSessionManagerFunctionLibrary::AreSettingsLoaded(const FeatureTy
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitSessionManagerFunctionLibrary::AreSettingsLoaded()"));
 
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    SessionManagerLibrary sessionManagerLibrary = runtimeModule->GetSessionManagerLibrary();
+    const SessionManagerLibrary& sessionManagerLibrary = FAwsGameKitRuntimeModule::Get().GetSessionManagerLibrary();
 
     return sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerAreSettingsLoaded(sessionManagerLibrary.SessionManagerInstanceHandle, AwsGameKitEnumConverter::ConvertFeatureEnum(featureType));
 }
@@ -66,8 +64,7 @@ void UAwsGameKitSessionManagerFunctionLibrary::SetToken(UObject* WorldContextObj
     {
         Action->LaunchThreadedWork([Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            SessionManagerLibrary sessionManagerLibrary = runtimeModule->GetSessionManagerLibrary();
+            const SessionManagerLibrary& sessionManagerLibrary = FAwsGameKitRuntimeModule::Get().GetSessionManagerLibrary();
 
             sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerSetToken(sessionManagerLibrary.SessionManagerInstanceHandle, AwsGameKitEnumConverter::ConvertTokenTypeEnum(Request.TokenType), TCHAR_TO_UTF8(*Request.TokenValue));
             State->Err = FAwsGameKitOperationResult{};
@@ -9,33 +9,90 @@
 #include "AwsGameKitRuntimeInternalHelpers.h"
 #include "AwsGameKitRuntimePublicHelpers.h"
 #include "Core/AwsGameKitErrors.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBuffer.h"
 
 // Unreal
-#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
 #include "Templates/Function.h"
 
-UserGameplayDataLibrary AwsGameKitUserGameplayData::GetUserGameplayDataLibraryFromModule()
+// Standard Library
+#include <atomic>
+#include <string>
+
+TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataBulkBatchSize(
+    TEXT("GameKit.UserGameplayData.Bulk.BatchSize"),
+    25,
+    TEXT("Number of items AwsGameKitUserGameplayData::AddBundleBulk() sends in each AddBundle call.\n"));
+
+TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataBulkMaxConcurrentBatches(
+    TEXT("GameKit.UserGameplayData.Bulk.MaxConcurrentBatches"),
+    4,
+    TEXT("Maximum number of batches AwsGameKitUserGameplayData::AddBundleBulk() sends at the same time.\n"));
+
+TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataBulkMaxRetries(
+    TEXT("GameKit.UserGameplayData.Bulk.MaxRetries"),
+    3,
+    TEXT("Number of times AwsGameKitUserGameplayData::AddBundleBulk() resends the items of a batch that the backend did not process.\n"));
+
+TAutoConsoleVariable<float> CVarGameKitUserGameplayDataBulkRetryBaseSeconds(
+    TEXT("GameKit.UserGameplayData.Bulk.RetryBaseSeconds"),
+    0.05f,
+    TEXT("Seconds AwsGameKitUserGameplayData::AddBundleBulk() waits before the first resend of unprocessed items. The wait doubles with each resend.\n")
+    TEXT("The waits of each worker add up to at most 0.25 seconds, after that the items it has not sent are returned as unprocessed.\n"));
+
+namespace
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitUserGameplayData::GetUserGameplayDataLibraryFromModule()"));
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
+    // AddBundleBulk() waits on a UserGameplayData executor lane, so the resend backoff is kept short to not hold the lane from other calls
+    constexpr float MaxBulkRetryBackoffSeconds = 0.25f;
+
+    // Delivers a result read from FAwsGameKitUserGameplayDataCache without queueing work. There is no call to cancel, so the handle is empty.
+    template <typename DelegateType, typename ResultType>
+    FAwsGameKitOperationHandle CompleteFromCache(const DelegateType& ResultDelegate, const ResultType& CachedResult)
+    {
+        const IntResult result(GameKit::GAMEKIT_SUCCESS);
+        if (IsInGameThread())
+        {
+            ResultDelegate.ExecuteIfBound(result, CachedResult);
+        }
+        else
+        {
+            InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, CachedResult);
+        }
+        return FAwsGameKitOperationHandle();
+    }
+
+    // FUserGameplayDataClientSettings::PaginationSize of the last SetClientSettings() call, the page size of ListBundlesPaginated() and GetBundlePaginated()
+    std::atomic<int32> PaginationSize { 100 };
 
-    return runtimeModule->GetUserGameplayDataLibrary();
+    // Continuation tokens hold the last bundle name or item key of their page. The library cannot resume a fetch, so a paginated call
+    // fetches from the first row again and only delivers the rows after the token. The backend queries return rows in ascending
+    // sort key order, which for DynamoDB string keys is the byte order of their UTF-8 encoding, so strcmp() matches it.
+    bool IsAfterContinuationToken(const char* Key, const std::string& ContinuationToken)
+    {
+        return ContinuationToken.empty() || FCStringAnsi::Strcmp(Key, ContinuationToken.c_str()) > 0;
+    }
 }
 
-void AwsGameKitUserGameplayData::AddBundle(const FUserGameplayDataBundle& userGameplayDataBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate)
+const UserGameplayDataLibrary& AwsGameKitUserGameplayData::GetUserGameplayDataLibraryFromModule()
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=] 
-    {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+    return FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
+}
+
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::AddBundle(const FUserGameplayDataBundle& userGameplayDataBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate)
+{
+    FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundle.BundleName);
 
-        int32 pairCount = userGameplayDataBundle.BundleMap.Num();
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.AddBundle"), [=] 
+    {
         IntResult result;
 
         // Instantiate struct to contain any unprocessed items that may be passed back
         FUserGameplayDataBundle unprocessedBundleItems;
 
-        if (pairCount == 0)
+        if (userGameplayDataBundle.BundleMap.Num() == 0)
         {
             UE_LOG(LogAwsGameKit, Error, TEXT("UAwsGameKitUserGameplayDataCallableWrapper::AddUserGameplayData - The bundle is empty."));
             result.Result = GameKit::GAMEKIT_ERROR_USER_GAMEPLAY_DATA_PAYLOAD_INVALID;
@@ -43,56 +100,148 @@ void AwsGameKitUserGameplayData::AddBundle(const FUserGameplayDataBundle& userGa
         }
         else
         {
-            // Preallocate with expected size to prevent pointers becoming invalid
-            // when array expands and data is copied.
-            TArray<std::string> bundleItemKeys;
-            bundleItemKeys.SetNum(pairCount);
-            TArray<const char*> bundleItemKeysChrArray;
-            bundleItemKeysChrArray.SetNum(pairCount);
-
-            TArray<std::string> bundleItemValues;
-            bundleItemValues.SetNum(pairCount);
-            TArray<const char*> bundleItemValuesChrArray;
-            bundleItemValuesChrArray.SetNum(pairCount);
-
-            int i = 0;
-            for (auto it = userGameplayDataBundle.BundleMap.begin(); it != userGameplayDataBundle.BundleMap.end(); ++it)
-            {
-                const FString& key = it.Key();
-                const FString& value = it.Value();
+            // In the case there is an unprocessed item, assign the bundle that it is a part of
+            unprocessedBundleItems.BundleName = userGameplayDataBundle.BundleName;
 
-                bundleItemKeys[i] = TCHAR_TO_UTF8(*key);
-                bundleItemValues[i] = TCHAR_TO_UTF8(*value);
+            result = RunAddBundle(userGameplayDataBundle.BundleName, userGameplayDataBundle.BundleMap, unprocessedBundleItems.BundleMap);
 
-                bundleItemKeysChrArray[i] = bundleItemKeys[i].c_str();
-                bundleItemValuesChrArray[i] = bundleItemValues[i].c_str();
+            // Drop any fetch of the bundle that was started while it was being written
+            FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundle.BundleName);
+        }
 
-                i++;
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, unprocessedBundleItems);
+    });
+}
+
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::AddBundleBulk(const FUserGameplayDataBundle& userGameplayDataBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate)
+{
+    FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundle.BundleName);
+
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.AddBundleBulk"), [=]
+    {
+        IntResult result;
+        FUserGameplayDataBundle unprocessedBundleItems;
+        unprocessedBundleItems.BundleName = userGameplayDataBundle.BundleName;
+
+        if (userGameplayDataBundle.BundleMap.Num() == 0)
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitUserGameplayData::AddBundleBulk() The bundle is empty."));
+            result.Result = GameKit::GAMEKIT_ERROR_USER_GAMEPLAY_DATA_PAYLOAD_INVALID;
+            result.ErrorMessage = "The bundle is empty";
+            InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, unprocessedBundleItems);
+            return;
+        }
+
+        const int32 batchSize = FMath::Max(CVarGameKitUserGameplayDataBulkBatchSize.GetValueOnAnyThread(), 1);
+        TArray<TMap<FString, FString>> batches;
+        batches.Reserve(FMath::DivideAndRoundUp(userGameplayDataBundle.BundleMap.Num(), batchSize));
+        for (const TPair<FString, FString>& item : userGameplayDataBundle.BundleMap)
+        {
+            if (batches.Num() == 0 || batches.Last().Num() == batchSize)
+            {
+                batches.AddDefaulted_GetRef().Reserve(batchSize);
             }
+            batches.Last().Add(item.Key, item.Value);
+        }
 
-            std::string bundleName = TCHAR_TO_UTF8(*userGameplayDataBundle.BundleName);
+        const int32 maxRetries = FMath::Max(CVarGameKitUserGameplayDataBulkMaxRetries.GetValueOnAnyThread(), 0);
+        const float retryBaseSeconds = FMath::Max(CVarGameKitUserGameplayDataBulkRetryBaseSeconds.GetValueOnAnyThread(), 0.0f);
 
-            // In the case there is an unprocessed item, assign the bundle that it is a part of
-            unprocessedBundleItems.BundleName = bundleName.c_str();
+        FCriticalSection resultsMutex;
+        std::atomic<int32> nextBatch { 0 };
 
-            UserGameplayDataBundle wrapperArgs
+        // Each worker takes the next batch until none are left
+        auto runBatches = [&]()
+        {
+            float backoffSecondsLeft = MaxBulkRetryBackoffSeconds;
+            for (int32 index = nextBatch++; index < batches.Num() && !InternalAwsGameKitIsOperationAbandoned(); index = nextBatch++)
             {
-                bundleName.c_str(),
-                (bundleItemKeysChrArray.GetData()),
-                (bundleItemValuesChrArray.GetData()),
-                size_t(pairCount)
-            };
+                TMap<FString, FString> pendingItems = MoveTemp(batches[index]);
+                IntResult batchResult;
+                for (int32 attempt = 0; ; ++attempt)
+                {
+                    TMap<FString, FString> unprocessedItems;
+                    batchResult = RunAddBundle(userGameplayDataBundle.BundleName, pendingItems, unprocessedItems);
+
+                    // A failure without unprocessed items is not one that resending fixes
+                    if (batchResult.Result == GameKit::GAMEKIT_SUCCESS || unprocessedItems.Num() == 0)
+                    {
+                        break;
+                    }
+
+                    pendingItems = MoveTemp(unprocessedItems);
+                    const float backoffSeconds = retryBaseSeconds * (float)(1 << FMath::Min(attempt, 16));
+                    if (attempt == maxRetries || backoffSeconds > backoffSecondsLeft || InternalAwsGameKitIsOperationAbandoned())
+                    {
+                        break;
+                    }
+
+                    backoffSecondsLeft -= backoffSeconds;
+                    FPlatformProcess::Sleep(backoffSeconds);
+                }
+
+                if (batchResult.Result != GameKit::GAMEKIT_SUCCESS)
+                {
+                    FScopeLock scopeLock(&resultsMutex);
+                    if (result.Result == GameKit::GAMEKIT_SUCCESS)
+                    {
+                        result = batchResult;
+                    }
+                    unprocessedBundleItems.BundleMap.Append(MoveTemp(pendingItems));
+                }
+            }
+        };
 
-            result = IntResult(library.UserGameplayDataWrapper->GameKitAddUserGameplayData(library.UserGameplayDataInstanceHandle, unprocessedBundleItems.BundleMap, wrapperArgs));
-        }
+        const int32 workerCount = FMath::Clamp(CVarGameKitUserGameplayDataBulkMaxConcurrentBatches.GetValueOnAnyThread(), 1, batches.Num());
+        InternalAwsGameKitRunOnWorkers(FeatureType_E::UserGameplayData, workerCount, runBatches);
+
+        FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundle.BundleName);
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, unprocessedBundleItems);
+        UE_LOG(LogAwsGameKit, Verbose, TEXT("AwsGameKitUserGameplayData::AddBundleBulk() Sent %d items in %d batches, %d items unprocessed."), userGameplayDataBundle.BundleMap.Num(), batches.Num(), unprocessedBundleItems.BundleMap.Num());
+
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, unprocessedBundleItems);
     });
 }
 
+IntResult AwsGameKitUserGameplayData::RunAddBundle(const FString& BundleName, const TMap<FString, FString>& Items, TMap<FString, FString>& OutUnprocessedItems)
+{
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+    const int32 pairCount = Items.Num();
+
+    // Size both buffers first, so the keys and values are converted with one allocation each
+    int32 keyBytes = 0;
+    int32 valueBytes = 0;
+    for (const TPair<FString, FString>& item : Items)
+    {
+        keyBytes += FAwsGameKitInternalUtf8Array::GetConvertedSize(item.Key);
+        valueBytes += FAwsGameKitInternalUtf8Array::GetConvertedSize(item.Value);
+    }
+
+    FAwsGameKitInternalUtf8Array bundleItemKeys;
+    FAwsGameKitInternalUtf8Array bundleItemValues;
+    bundleItemKeys.Reserve(pairCount, keyBytes);
+    bundleItemValues.Reserve(pairCount, valueBytes);
+    for (const TPair<FString, FString>& item : Items)
+    {
+        bundleItemKeys.Add(item.Key);
+        bundleItemValues.Add(item.Value);
+    }
+
+    FAwsGameKitInternalTempStrings ConvertString;
+    UserGameplayDataBundle wrapperArgs
+    {
+        ConvertString(BundleName),
+        bundleItemKeys.GetData(),
+        bundleItemValues.GetData(),
+        size_t(pairCount)
+    };
+
+    return IntResult(library.UserGameplayDataWrapper->GameKitAddUserGameplayData(library.UserGameplayDataInstanceHandle, OutUnprocessedItems, wrapperArgs));
+}
+
 void AwsGameKitUserGameplayData::SetClientSettings(const FUserGameplayDataClientSettings& clientSettings)
 {
-    UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
     UserGameplayDataClientSettings settings;
     settings.ClientTimeoutSeconds = clientSettings.ClientTimeoutSeconds;
@@ -102,45 +251,154 @@ void AwsGameKitUserGameplayData::SetClientSettings(const FUserGameplayDataClient
     settings.RetryStrategy = clientSettings.RetryStrategy;
     settings.MaxExponentialRetryThreshold = clientSettings.MaxExponentialRetryThreshold;
     settings.PaginationSize = clientSettings.PaginationSize;
+    PaginationSize = FMath::Max(clientSettings.PaginationSize, 1);
 
     library.UserGameplayDataWrapper->GameKitSetUserGameplayDataClientSettings(library.UserGameplayDataInstanceHandle, settings);
 }
 
-void AwsGameKitUserGameplayData::ListBundles(TAwsGameKitDelegateParam<const IntResult&, const TArray<FString>&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::ListBundles(TAwsGameKitDelegateParam<const IntResult&, const TArray<FString>&> ResultDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.ListBundles"), [=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
         TArray<FString> bundles;
         IntResult result(library.UserGameplayDataWrapper->GameKitListUserGameplayDataBundles(library.UserGameplayDataInstanceHandle, bundles));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, bundles);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, bundles);
     });
 }
 
-void AwsGameKitUserGameplayData::GetBundle(const FString& UserGameplayDataBundleName, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::ListBundlesPaginated(const FString& ContinuationToken,
+    TAwsGameKitDelegateParam<const FUserGameplayDataBundleNamesPage&> PartialResultDelegate,
+    FAwsGameKitStatusDelegateParam OperationCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=] 
+    const int32 pageSize = PaginationSize;
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.ListBundlesPaginated"), [=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+
+        const std::string continuationToken(TCHAR_TO_UTF8(*ContinuationToken));
+        FUserGameplayDataBundleNamesPage page;
+        auto deliverPage = [&]()
+        {
+            page.ContinuationToken = page.BundleNames.Last();
+            InternalAwsGameKitRunDelegateOnGameThread(PartialResultDelegate, MoveTemp(page));
+            page = FUserGameplayDataBundleNamesPage();
+        };
+
+        IntResult result = library.UserGameplayDataWrapper->GameKitListUserGameplayDataBundlesStreamed(library.UserGameplayDataInstanceHandle, [&](const char* bundleName)
+        {
+            if (!IsAfterContinuationToken(bundleName, continuationToken) || InternalAwsGameKitIsOperationAbandoned())
+            {
+                return;
+            }
+
+            page.BundleNames.Emplace(UTF8_TO_TCHAR(bundleName));
+            if (page.BundleNames.Num() == pageSize)
+            {
+                deliverPage();
+            }
+        });
+
+        // A failed listing may have stopped partway through the page, so it is dropped and the caller continues from the last full page
+        if (result.Result == GameKit::GAMEKIT_SUCCESS && page.BundleNames.Num() > 0)
+        {
+            deliverPage();
+        }
+
+        InternalAwsGameKitRunDelegateOnGameThread(OperationCompleteDelegate, result);
+    });
+}
+
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::GetBundle(const FString& UserGameplayDataBundleName, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate)
+{
+    FAwsGameKitUserGameplayDataCache& cache = FAwsGameKitUserGameplayDataCache::Get();
+    FUserGameplayDataBundle cachedBundle;
+    if (cache.FindBundle(UserGameplayDataBundleName, cachedBundle.BundleMap))
+    {
+        cachedBundle.BundleName = UserGameplayDataBundleName;
+        return CompleteFromCache(ResultDelegate, cachedBundle);
+    }
+
+    const int64 cacheVersion = cache.GetVersion(UserGameplayDataBundleName);
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.GetBundle"), [=] 
+    {
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
         FUserGameplayDataBundle bundle;
         bundle.BundleName = UserGameplayDataBundleName;
         IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, bundle.BundleMap, TCHAR_TO_UTF8(*UserGameplayDataBundleName)));
+        if (result.Result == GameKit::GAMEKIT_SUCCESS)
+        {
+            FAwsGameKitUserGameplayDataCache::Get().Store(UserGameplayDataBundleName, bundle.BundleMap, cacheVersion);
+        }
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, bundle);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, bundle);
     });
 }
 
-void AwsGameKitUserGameplayData::GetBundleItem(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> ResultDelegate)
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::GetBundlePaginated(const FString& UserGameplayDataBundleName,
+    const FString& ContinuationToken,
+    TAwsGameKitDelegateParam<const FUserGameplayDataBundlePage&> PartialResultDelegate,
+    FAwsGameKitStatusDelegateParam OperationCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    const int32 pageSize = PaginationSize;
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.GetBundlePaginated"), [=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+
+        const std::string continuationToken(TCHAR_TO_UTF8(*ContinuationToken));
+        FString lastKey;
+        FUserGameplayDataBundlePage page;
+        page.BundleName = UserGameplayDataBundleName;
+        auto deliverPage = [&]()
+        {
+            page.ContinuationToken = lastKey;
+            InternalAwsGameKitRunDelegateOnGameThread(PartialResultDelegate, MoveTemp(page));
+            page = FUserGameplayDataBundlePage();
+            page.BundleName = UserGameplayDataBundleName;
+        };
+
+        FAwsGameKitInternalTempStrings ConvertString;
+        IntResult result = library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundleStreamed(library.UserGameplayDataInstanceHandle, ConvertString(UserGameplayDataBundleName), [&](const char* key, const char* value)
+        {
+            if (!IsAfterContinuationToken(key, continuationToken) || InternalAwsGameKitIsOperationAbandoned())
+            {
+                return;
+            }
+
+            lastKey = UTF8_TO_TCHAR(key);
+            page.BundleMap.Add(lastKey, UTF8_TO_TCHAR(value));
+            if (page.BundleMap.Num() == pageSize)
+            {
+                deliverPage();
+            }
+        });
+
+        // A failed retrieval may have stopped partway through the page, so it is dropped and the caller continues from the last full page
+        if (result.Result == GameKit::GAMEKIT_SUCCESS && page.BundleMap.Num() > 0)
+        {
+            deliverPage();
+        }
+
+        InternalAwsGameKitRunDelegateOnGameThread(OperationCompleteDelegate, result);
+    });
+}
+
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::GetBundleItem(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> ResultDelegate)
+{
+    FUserGameplayDataBundleItemValue cachedItem;
+    if (FAwsGameKitUserGameplayDataCache::Get().FindItem(userGameplayDataBundleItem.BundleName, userGameplayDataBundleItem.BundleItemKey, cachedItem.BundleItemValue))
+    {
+        cachedItem.BundleName = userGameplayDataBundleItem.BundleName;
+        cachedItem.BundleItemKey = userGameplayDataBundleItem.BundleItemKey;
+        return CompleteFromCache(ResultDelegate, cachedItem);
+    }
+
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.GetBundleItem"), [=]
+    {
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
         FUserGameplayDataBundleItemValue bundleItem;
         bundleItem.BundleName = userGameplayDataBundleItem.BundleName;
@@ -155,16 +413,17 @@ void AwsGameKitUserGameplayData::GetBundleItem(const FUserGameplayDataBundleItem
 
         IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundleItem(library.UserGameplayDataInstanceHandle, bundleItem.BundleItemValue, wrapperArgs));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, bundleItem);
+        InternalAwsGameKitRunDelegateOnGameThread(ResultDelegate, result, bundleItem);
     });
 }
 
-void AwsGameKitUserGameplayData::UpdateItem(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::UpdateItem(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundleItemValue.BundleName);
+
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.UpdateItem"), [=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
         FAwsGameKitInternalTempStrings ConvertString;
         UserGameplayDataBundleItemValue wrapperArgs
@@ -175,43 +434,59 @@ void AwsGameKitUserGameplayData::UpdateItem(const FUserGameplayDataBundleItemVal
         };
 
         IntResult result(library.UserGameplayDataWrapper->GameKitUpdateUserGameplayDataBundleItem(library.UserGameplayDataInstanceHandle, wrapperArgs));
+        FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundleItemValue.BundleName);
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitUserGameplayData::DeleteAllData(FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+void AwsGameKitUserGameplayData::UpdateItemBuffered(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+{
+    FAwsGameKitUserGameplayDataWriteBuffer::Get().Write(userGameplayDataBundleItemValue, OnCompleteDelegate);
+}
+
+void AwsGameKitUserGameplayData::FlushBufferedWrites()
+{
+    FAwsGameKitUserGameplayDataWriteBuffer::Get().Flush();
+}
+
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::DeleteAllData(FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    FAwsGameKitUserGameplayDataCache::Get().Clear();
+
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.DeleteAllData"), [=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
         IntResult result(library.UserGameplayDataWrapper->GameKitDeleteAllUserGameplayData(library.UserGameplayDataInstanceHandle));
+        FAwsGameKitUserGameplayDataCache::Get().Clear();
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitUserGameplayData::DeleteBundle(const FString& UserGameplayDataBundleName, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::DeleteBundle(const FString& UserGameplayDataBundleName, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    FAwsGameKitUserGameplayDataCache::Get().Invalidate(UserGameplayDataBundleName);
+
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.DeleteBundle"), [=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
         IntResult result(library.UserGameplayDataWrapper->GameKitDeleteUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*UserGameplayDataBundleName)));
+        FAwsGameKitUserGameplayDataCache::Get().Invalidate(UserGameplayDataBundleName);
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitUserGameplayData::DeleteBundleItems(const FUserGameplayDataDeleteItemsRequest& userGameplayDataBundleItemsDeleteRequest, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::DeleteBundleItems(const FUserGameplayDataDeleteItemsRequest& userGameplayDataBundleItemsDeleteRequest, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundleItemsDeleteRequest.BundleName);
+
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.DeleteBundleItems"), [=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
         IntResult result;
 
@@ -224,53 +499,40 @@ void AwsGameKitUserGameplayData::DeleteBundleItems(const FUserGameplayDataDelete
         }
         else
         {    
-            // Preallocate with expected size to prevent pointers becoming invalid
-            // when array expands and data is copied.
-            int32 numKeys = userGameplayDataBundleItemsDeleteRequest.BundleItemKeys.Num();
-            TArray<std::string> bundleItemKeys;
-            bundleItemKeys.SetNum(numKeys);
-            TArray<const char*> bundleItemKeysChrArray;
-            bundleItemKeysChrArray.SetNum(numKeys);
-
-            for (int i = 0; i < numKeys; i++)
-            {
-                auto& itemKey = userGameplayDataBundleItemsDeleteRequest.BundleItemKeys[i];
-
-                bundleItemKeys[i] = TCHAR_TO_UTF8(*itemKey);
-
-                bundleItemKeysChrArray[i] = bundleItemKeys[i].c_str();
-            }
+            FAwsGameKitInternalUtf8Array bundleItemKeys;
+            bundleItemKeys.Append(userGameplayDataBundleItemsDeleteRequest.BundleItemKeys);
 
-            std::string bundleName = TCHAR_TO_UTF8(*userGameplayDataBundleItemsDeleteRequest.BundleName);
+            FAwsGameKitInternalTempStrings ConvertString;
             UserGameplayDataDeleteItemsRequest wrapperArgs
             {
-                bundleName.c_str(),
-                (bundleItemKeysChrArray.GetData()),
-                size_t(numKeys)
+                ConvertString(userGameplayDataBundleItemsDeleteRequest.BundleName),
+                bundleItemKeys.GetData(),
+                size_t(bundleItemKeys.Num())
             };
 
             result = library.UserGameplayDataWrapper->GameKitDeleteUserGameplayDataBundleItems(library.UserGameplayDataInstanceHandle, wrapperArgs);
+            FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundleItemsDeleteRequest.BundleName);
         }
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
 void AwsGameKitUserGameplayData::StartRetryBackgroundThread()
 {
-    UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataStartRetryBackgroundThread(library.UserGameplayDataInstanceHandle);
 }
 
 void AwsGameKitUserGameplayData::StopRetryBackgroundThread()
 {
-    UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataStopRetryBackgroundThread(library.UserGameplayDataInstanceHandle);
 }
 
 void AwsGameKitUserGameplayData::DropAllCachedEvents()
 {
-    UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataDropAllCachedEvents(library.UserGameplayDataInstanceHandle);
 }
 
@@ -278,10 +540,10 @@ void AwsGameKitUserGameplayData::SetNetworkChangeDelegate(const FNetworkStatusCh
 {
     if (networkStatusChangeDelegate.IsBound())
     {
-        FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
+        FAwsGameKitRuntimeModule* runtimeModule = &FAwsGameKitRuntimeModule::Get();
         runtimeModule->SetNetworkChangeDelegate(networkStatusChangeDelegate);
 
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
         library.UserGameplayDataWrapper->GameKitUserGameplayDataSetNetworkChangeCallback(library.UserGameplayDataInstanceHandle, runtimeModule, &FAwsGameKitRuntimeModule::OnNetworkStatusChangeDispatcher::Dispatch);
     }
 }
@@ -290,14 +552,12 @@ void AwsGameKitUserGameplayData::SetCacheProcessedDelegate(const FCacheProcessed
 {
     if (cacheProcessedDelegate.IsBound())
     {
-        FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-        UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+        const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
         library.UserGameplayDataStateHandler->SetCacheProcessedDelegate(cacheProcessedDelegate);
 
         auto cacheProcessedDelegateExecutor = [](const bool isCacheProcessed)
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
             library.UserGameplayDataStateHandler->onCacheProcessedDelegate.ExecuteIfBound(isCacheProcessed);
         };
         typedef LambdaDispatcher<decltype(cacheProcessedDelegateExecutor), void, const bool> CacheProcessedDelegateExecuter;
@@ -306,28 +566,26 @@ void AwsGameKitUserGameplayData::SetCacheProcessedDelegate(const FCacheProcessed
     }
 }
 
-void AwsGameKitUserGameplayData::PersistToCache(const FString& cacheFile, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::PersistToCache(const FString& cacheFile, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.PersistToCache"), [=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
         IntResult result(library.UserGameplayDataWrapper->GameKitUserGameplayDataPersistApiCallsToCache(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*cacheFile)));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
 
-void AwsGameKitUserGameplayData::LoadFromCache(const FString& cacheFile, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+FAwsGameKitOperationHandle AwsGameKitUserGameplayData::LoadFromCache(const FString& cacheFile, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    return InternalAwsGameKitRunLambdaOnWorkThread(FeatureType_E::UserGameplayData, TEXT("UserGameplayData.LoadFromCache"), [=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
         IntResult result(library.UserGameplayDataWrapper->GameKitUserGameplayDataLoadApiCallsFromCache(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*cacheFile)));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+        InternalAwsGameKitRunDelegateOnGameThread(OnCompleteDelegate, result);
     });
 }
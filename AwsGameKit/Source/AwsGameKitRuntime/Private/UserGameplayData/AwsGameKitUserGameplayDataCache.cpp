@@ -0,0 +1,235 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+
+// Unreal
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+TAutoConsoleVariable<float> CVarGameKitUserGameplayDataCacheTtlSeconds(
+    TEXT("GameKit.UserGameplayData.Cache.TtlSeconds"),
+    0.0f,
+    TEXT("Seconds a bundle fetched by AwsGameKitUserGameplayData::GetBundle() is served from FAwsGameKitUserGameplayDataCache before it is fetched again.\n")
+    TEXT(" <=0: the cache is disabled\n"));
+
+namespace
+{
+    // "GKU2", files without a player ID were "GKU1"
+    constexpr uint32 UserGameplayDataCacheMagic = 0x32554B47;
+}
+
+FAwsGameKitUserGameplayDataCache& FAwsGameKitUserGameplayDataCache::Get()
+{
+    static FAwsGameKitUserGameplayDataCache Cache;
+    return Cache;
+}
+
+bool FAwsGameKitUserGameplayDataCache::IsEnabled()
+{
+    return CVarGameKitUserGameplayDataCacheTtlSeconds.GetValueOnAnyThread() > 0.0f;
+}
+
+bool FAwsGameKitUserGameplayDataCache::FindBundle(const FString& BundleName, TMap<FString, FString>& OutItems)
+{
+    FScopeLock scopeLock(&mutex);
+    const FEntry* entry = FindFresh(BundleName);
+    if (entry == nullptr)
+    {
+        return false;
+    }
+
+    OutItems = entry->Items;
+    return true;
+}
+
+bool FAwsGameKitUserGameplayDataCache::FindItem(const FString& BundleName, const FString& ItemKey, FString& OutValue)
+{
+    FScopeLock scopeLock(&mutex);
+    const FEntry* entry = FindFresh(BundleName);
+    const FString* value = entry != nullptr ? entry->Items.Find(ItemKey) : nullptr;
+    if (value == nullptr)
+    {
+        return false;
+    }
+
+    OutValue = *value;
+    return true;
+}
+
+int64 FAwsGameKitUserGameplayDataCache::GetVersion(const FString& BundleName)
+{
+    FScopeLock scopeLock(&mutex);
+    return GetVersionLocked(BundleName);
+}
+
+void FAwsGameKitUserGameplayDataCache::Store(const FString& BundleName, const TMap<FString, FString>& Items, int64 FetchedVersion)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    FScopeLock scopeLock(&mutex);
+    if (GetVersionLocked(BundleName) != FetchedVersion)
+    {
+        UE_LOG(LogAwsGameKit, Verbose, TEXT("FAwsGameKitUserGameplayDataCache::Store() Bundle %s changed while it was fetched, not caching it."), *BundleName);
+        return;
+    }
+
+    FEntry& entry = bundles.FindOrAdd(BundleName);
+    entry.FetchTime = FDateTime::UtcNow();
+    entry.Items = Items;
+    versions.Add(BundleName, ++versionCounter);
+}
+
+void FAwsGameKitUserGameplayDataCache::Invalidate(const FString& BundleName)
+{
+    FScopeLock scopeLock(&mutex);
+    bundles.Remove(BundleName);
+    versions.Add(BundleName, ++versionCounter);
+}
+
+void FAwsGameKitUserGameplayDataCache::Clear()
+{
+    FScopeLock scopeLock(&mutex);
+    bundles.Empty();
+    versions.Empty();
+    clearedVersion = ++versionCounter;
+}
+
+void FAwsGameKitUserGameplayDataCache::ClearPlayerData()
+{
+    Clear();
+
+    TSet<FString> filesToDelete;
+    {
+        FScopeLock scopeLock(&mutex);
+        filesToDelete = MoveTemp(filePaths);
+        filePaths.Reset();
+    }
+
+    for (const FString& filePath : filesToDelete)
+    {
+        UE_LOG(LogAwsGameKit, Verbose, TEXT("FAwsGameKitUserGameplayDataCache::ClearPlayerData() Deleting %s."), *filePath);
+        IFileManager::Get().Delete(*filePath, false, false, true);
+    }
+}
+
+bool FAwsGameKitUserGameplayDataCache::SaveToFile(const FString& FilePath, const FString& PlayerId)
+{
+    TArray<uint8> bytes;
+    FMemoryWriter writer(bytes);
+    {
+        FScopeLock scopeLock(&mutex);
+        filePaths.Add(FilePath);
+        uint32 magic = UserGameplayDataCacheMagic;
+        FString playerId = PlayerId;
+        int32 bundleCount = bundles.Num();
+        writer << magic;
+        writer << playerId;
+        writer << bundleCount;
+        for (TPair<FString, FEntry>& bundle : bundles)
+        {
+            int64 ticks = bundle.Value.FetchTime.GetTicks();
+            writer << bundle.Key;
+            writer << ticks;
+            writer << bundle.Value.Items;
+        }
+    }
+
+    return FFileHelper::SaveArrayToFile(bytes, *FilePath);
+}
+
+bool FAwsGameKitUserGameplayDataCache::LoadFromFile(const FString& FilePath, const FString& PlayerId)
+{
+    TArray<uint8> bytes;
+    if (!FFileHelper::LoadFileToArray(bytes, *FilePath, FILEREAD_Silent))
+    {
+        return false;
+    }
+
+    FMemoryReader reader(bytes);
+    uint32 magic = 0;
+    FString playerId;
+    int32 bundleCount = 0;
+    reader << magic;
+    if (!reader.IsError() && magic == UserGameplayDataCacheMagic)
+    {
+        reader << playerId;
+        reader << bundleCount;
+    }
+
+    if (reader.IsError() || magic != UserGameplayDataCacheMagic || bundleCount < 0)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataCache::LoadFromFile() %s is not a User Gameplay Data cache file."), *FilePath);
+        return false;
+    }
+
+    if (playerId != PlayerId)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataCache::LoadFromFile() %s was saved for another player, ignoring it."), *FilePath);
+        return false;
+    }
+
+    TMap<FString, FEntry> loadedBundles;
+    for (int32 i = 0; i < bundleCount && !reader.IsError(); i++)
+    {
+        FString bundleName;
+        int64 ticks = 0;
+        FEntry entry;
+        reader << bundleName;
+        reader << ticks;
+        reader << entry.Items;
+        entry.FetchTime = FDateTime(ticks);
+        loadedBundles.Add(MoveTemp(bundleName), MoveTemp(entry));
+    }
+
+    if (reader.IsError())
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataCache::LoadFromFile() %s is damaged."), *FilePath);
+        return false;
+    }
+
+    FScopeLock scopeLock(&mutex);
+    filePaths.Add(FilePath);
+    for (TPair<FString, FEntry>& bundle : loadedBundles)
+    {
+        if (!bundles.Contains(bundle.Key))
+        {
+            versions.Add(bundle.Key, ++versionCounter);
+            bundles.Add(bundle.Key, MoveTemp(bundle.Value));
+        }
+    }
+
+    return true;
+}
+
+const FAwsGameKitUserGameplayDataCache::FEntry* FAwsGameKitUserGameplayDataCache::FindFresh(const FString& BundleName) const
+{
+    const float ttlSeconds = CVarGameKitUserGameplayDataCacheTtlSeconds.GetValueOnAnyThread();
+    if (ttlSeconds <= 0.0f)
+    {
+        return nullptr;
+    }
+
+    const FEntry* entry = bundles.Find(BundleName);
+    if (entry == nullptr || (FDateTime::UtcNow() - entry->FetchTime).GetTotalSeconds() >= ttlSeconds)
+    {
+        return nullptr;
+    }
+
+    return entry;
+}
+
+int64 FAwsGameKitUserGameplayDataCache::GetVersionLocked(const FString& BundleName) const
+{
+    return FMath::Max(versions.FindRef(BundleName), clearedVersion);
+}
@@ -10,6 +10,7 @@
 #include "AwsGameKitUserGameplayData.h"
 #include "Core/AwsGameKitErrors.h"
 #include "Core/Logging.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
 
 // Unreal
 #include "LatentActions.h"
@@ -25,19 +26,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::SetClientSettings(const FUserGa
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::SetClientSettings()"));
 
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
-
-    UserGameplayDataClientSettings settings;
-    settings.ClientTimeoutSeconds = clientSettings.ClientTimeoutSeconds;
-    settings.RetryIntervalSeconds = clientSettings.RetryIntervalSeconds;
-    settings.MaxRetryQueueSize = clientSettings.MaxRetryQueueSize;
-    settings.MaxRetries = clientSettings.MaxRetries;
-    settings.RetryStrategy = clientSettings.RetryStrategy;
-    settings.MaxExponentialRetryThreshold = clientSettings.MaxExponentialRetryThreshold;
-    settings.PaginationSize = clientSettings.PaginationSize;
-
-    library.UserGameplayDataWrapper->GameKitSetUserGameplayDataClientSettings(library.UserGameplayDataInstanceHandle, settings);
+    AwsGameKitUserGameplayData::SetClientSettings(clientSettings);
 }
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::AddBundle(
@@ -55,8 +44,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::AddBundle(
     {
         Action->LaunchThreadedWork([userGameplayDataBundle, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             int32 pairCount = userGameplayDataBundle.BundleMap.Num();
             IntResult result;
@@ -69,44 +57,37 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::AddBundle(
             }
             else
             {
-                // Preallocate with expected size to prevent pointers becoming invalid
-                // when array expands and data is copied.
-                TArray<std::string> bundleItemKeys;
-                bundleItemKeys.SetNum(pairCount);
-                TArray<const char*> bundleItemKeysChrArray;
-                bundleItemKeysChrArray.SetNum(pairCount);
-
-                TArray<std::string> bundleItemValues;
-                bundleItemValues.SetNum(pairCount);
-                TArray<const char*> bundleItemValuesChrArray;
-                bundleItemValuesChrArray.SetNum(pairCount);
-
-                int i = 0;
-                for (auto it = userGameplayDataBundle.BundleMap.begin(); it != userGameplayDataBundle.BundleMap.end(); ++it)
+                // Size both buffers first, so the keys and values are converted with one allocation each
+                int32 keyBytes = 0;
+                int32 valueBytes = 0;
+                for (const TPair<FString, FString>& item : userGameplayDataBundle.BundleMap)
                 {
-                    const FString& key = it.Key();
-                    const FString& value = it.Value();
-
-                    bundleItemKeys[i] = TCHAR_TO_UTF8(*key);
-                    bundleItemValues[i] = TCHAR_TO_UTF8(*value);
-
-                    bundleItemKeysChrArray[i] = bundleItemKeys[i].c_str();
-                    bundleItemValuesChrArray[i] = bundleItemValues[i].c_str();
+                    keyBytes += FAwsGameKitInternalUtf8Array::GetConvertedSize(item.Key);
+                    valueBytes += FAwsGameKitInternalUtf8Array::GetConvertedSize(item.Value);
+                }
 
-                    i++;
+                FAwsGameKitInternalUtf8Array bundleItemKeys;
+                FAwsGameKitInternalUtf8Array bundleItemValues;
+                bundleItemKeys.Reserve(pairCount, keyBytes);
+                bundleItemValues.Reserve(pairCount, valueBytes);
+                for (const TPair<FString, FString>& item : userGameplayDataBundle.BundleMap)
+                {
+                    bundleItemKeys.Add(item.Key);
+                    bundleItemValues.Add(item.Value);
                 }
 
-                std::string bundleName = TCHAR_TO_UTF8(*userGameplayDataBundle.BundleName);
-                State->Results.BundleName = bundleName.c_str();
+                FAwsGameKitInternalTempStrings ConvertString;
+                State->Results.BundleName = userGameplayDataBundle.BundleName;
                 UserGameplayDataBundle wrapperArgs
                 {
-                    bundleName.c_str(),
-                    (bundleItemKeysChrArray.GetData()),
-                    (bundleItemValuesChrArray.GetData()),
+                    ConvertString(userGameplayDataBundle.BundleName),
+                    bundleItemKeys.GetData(),
+                    bundleItemValues.GetData(),
                     size_t(pairCount)
                 };
 
                 result = IntResult(library.UserGameplayDataWrapper->GameKitAddUserGameplayData(library.UserGameplayDataInstanceHandle, State->Results.BundleMap, wrapperArgs));
+                FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundle.BundleName);
             }
 
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
@@ -123,8 +104,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::ListBundles(UObject* WorldConte
     {
         Action->LaunchThreadedWork([State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             IntResult result(library.UserGameplayDataWrapper->GameKitListUserGameplayDataBundles(library.UserGameplayDataInstanceHandle, State->Results));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
@@ -141,11 +121,22 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::GetBundle(UObject* WorldContext
     {
         Action->LaunchThreadedWork([userGameplayDataBundleName, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
+            FAwsGameKitUserGameplayDataCache& cache = FAwsGameKitUserGameplayDataCache::Get();
 
             State->Results.BundleName = userGameplayDataBundleName;
+            if (cache.FindBundle(userGameplayDataBundleName, State->Results.BundleMap))
+            {
+                State->Err = FAwsGameKitOperationResult{};
+                return;
+            }
+
+            const int64 cacheVersion = cache.GetVersion(userGameplayDataBundleName);
             IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, State->Results.BundleMap, TCHAR_TO_UTF8(*userGameplayDataBundleName)));
+            if (result.Result == GameKit::GAMEKIT_SUCCESS)
+            {
+                cache.Store(userGameplayDataBundleName, State->Results.BundleMap, cacheVersion);
+            }
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
     }
@@ -160,8 +151,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::GetBundleItem(UObject* WorldCon
     {
         Action->LaunchThreadedWork([userGameplayDataBundleItem, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             FAwsGameKitInternalTempStrings ConvertString;
             UserGameplayDataBundleItem wrapperArgs
@@ -172,6 +162,12 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::GetBundleItem(UObject* WorldCon
 
             State->Results.BundleName = userGameplayDataBundleItem.BundleName;
             State->Results.BundleItemKey = userGameplayDataBundleItem.BundleItemKey;
+            if (FAwsGameKitUserGameplayDataCache::Get().FindItem(userGameplayDataBundleItem.BundleName, userGameplayDataBundleItem.BundleItemKey, State->Results.BundleItemValue))
+            {
+                State->Err = FAwsGameKitOperationResult{};
+                return;
+            }
+
             IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundleItem(library.UserGameplayDataInstanceHandle, State->Results.BundleItemValue, wrapperArgs));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
@@ -187,8 +183,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::UpdateItem(UObject* WorldContex
     {
         Action->LaunchThreadedWork([userGameplayDataBundleItemValue, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             FAwsGameKitInternalTempStrings ConvertString;
             UserGameplayDataBundleItemValue wrapperArgs
@@ -199,6 +194,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::UpdateItem(UObject* WorldContex
             };
 
             IntResult result(library.UserGameplayDataWrapper->GameKitUpdateUserGameplayDataBundleItem(library.UserGameplayDataInstanceHandle, wrapperArgs));
+            FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundleItemValue.BundleName);
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
     }
@@ -213,10 +209,10 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteAllData(UObject* WorldCon
     {
         Action->LaunchThreadedWork([State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             IntResult result(library.UserGameplayDataWrapper->GameKitDeleteAllUserGameplayData(library.UserGameplayDataInstanceHandle));
+            FAwsGameKitUserGameplayDataCache::Get().Clear();
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
     }
@@ -231,10 +227,10 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundle(UObject* WorldCont
     {
         Action->LaunchThreadedWork([userGameplayDataBundleName, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             IntResult result(library.UserGameplayDataWrapper->GameKitDeleteUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*userGameplayDataBundleName)));
+            FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundleName);
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
     }
@@ -249,8 +245,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundleItems(UObject* Worl
     {
         Action->LaunchThreadedWork([userGameplayDataBundleItemsDeleteRequest, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
             IntResult result;
 
             if (userGameplayDataBundleItemsDeleteRequest.BundleItemKeys.Num() == 0 ||
@@ -262,32 +257,19 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundleItems(UObject* Worl
             }
             else
             {
-                // Preallocate with expected size to prevent pointers becoming invalid
-                // when array expands and data is copied.
-                int32 numKeys = userGameplayDataBundleItemsDeleteRequest.BundleItemKeys.Num();
-                TArray<std::string> bundleItemKeys;
-                bundleItemKeys.SetNum(numKeys);
-                TArray<const char*> bundleItemKeysChrArray;
-                bundleItemKeysChrArray.SetNum(numKeys);
-
-                for (int i = 0; i < numKeys; i++)
-                {
-                    auto& itemKey = userGameplayDataBundleItemsDeleteRequest.BundleItemKeys[i];
-
-                    bundleItemKeys[i] = TCHAR_TO_UTF8(*itemKey);
-
-                    bundleItemKeysChrArray[i] = bundleItemKeys[i].c_str();
-                }
+                FAwsGameKitInternalUtf8Array bundleItemKeys;
+                bundleItemKeys.Append(userGameplayDataBundleItemsDeleteRequest.BundleItemKeys);
 
-                std::string bundleName = TCHAR_TO_UTF8(*userGameplayDataBundleItemsDeleteRequest.BundleName);
+                FAwsGameKitInternalTempStrings ConvertString;
                 UserGameplayDataDeleteItemsRequest wrapperArgs
                 {
-                    bundleName.c_str(),
-                    (bundleItemKeysChrArray.GetData()),
-                    size_t(numKeys)
+                    ConvertString(userGameplayDataBundleItemsDeleteRequest.BundleName),
+                    bundleItemKeys.GetData(),
+                    size_t(bundleItemKeys.Num())
                 };
 
                 result = library.UserGameplayDataWrapper->GameKitDeleteUserGameplayDataBundleItems(library.UserGameplayDataInstanceHandle, wrapperArgs);
+                FAwsGameKitUserGameplayDataCache::Get().Invalidate(userGameplayDataBundleItemsDeleteRequest.BundleName);
             }
 
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
@@ -301,10 +283,10 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::SetNetworkChangeDelegate(const
 
     if (NetworkStatusChangeDelegate.IsBound())
     {
-        FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
+        FAwsGameKitRuntimeModule* runtimeModule = &FAwsGameKitRuntimeModule::Get();
         runtimeModule->SetNetworkChangeDelegate(NetworkStatusChangeDelegate);
 
-        UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+        const UserGameplayDataLibrary& library = runtimeModule->GetUserGameplayDataLibrary();
         library.UserGameplayDataWrapper->GameKitUserGameplayDataSetNetworkChangeCallback(library.UserGameplayDataInstanceHandle, runtimeModule, &FAwsGameKitRuntimeModule::OnNetworkStatusChangeDispatcher::Dispatch);
     }
 }
@@ -315,14 +297,12 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::SetCacheProcessedDelegate(const
 
     if (CacheProcessedDelegate.IsBound())
     {
-        FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-        UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+        const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
         library.UserGameplayDataStateHandler->SetCacheProcessedDelegate(CacheProcessedDelegate);
 
         auto cacheProcessedDelegateExecutor = [](const bool isCacheProcessed)
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
             library.UserGameplayDataStateHandler->onCacheProcessedDelegate.ExecuteIfBound(isCacheProcessed);
         };
         typedef LambdaDispatcher<decltype(cacheProcessedDelegateExecutor), void, const bool> CacheProcessedDelegateExecutor;
@@ -335,8 +315,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::StartRetryBackgroundThread()
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::StartRetryBackgroundThread()"));
 
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+    const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataStartRetryBackgroundThread(library.UserGameplayDataInstanceHandle);
 }
 
@@ -344,8 +323,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::StopRetryBackgroundThread()
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::StopRetryBackgroundThread()"));
 
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+    const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataStopRetryBackgroundThread(library.UserGameplayDataInstanceHandle);
 }
 
@@ -353,8 +331,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::DropAllCachedEvents()
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::DropAllCachedEvents()"));
 
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+    const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataDropAllCachedEvents(library.UserGameplayDataInstanceHandle);
 }
 
@@ -367,8 +344,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::PersistToCache(UObject* WorldCo
     {
         Action->LaunchThreadedWork([CacheFile, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
 #if PLATFORM_ANDROID
             // Convert to platform path
@@ -391,8 +367,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::LoadFromCache(UObject* WorldCon
     {
         Action->LaunchThreadedWork([CacheFile, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
 #if PLATFORM_ANDROID
             // Convert to platform path
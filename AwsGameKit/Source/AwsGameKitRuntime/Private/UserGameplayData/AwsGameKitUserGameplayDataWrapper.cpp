@@ -91,6 +91,30 @@ unsigned int AwsGameKitUserGameplayDataWrapper::GameKitListUserGameplayDataBundl
     return result.Result;
 }
 
+unsigned int AwsGameKitUserGameplayDataWrapper::GameKitListUserGameplayDataBundlesStreamed(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TFunctionRef<void(const char* bundleName)> onBundle)
+{
+    CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitListUserGameplayDataBundles, GameKit::GAMEKIT_ERROR_GENERAL);
+
+    auto userDataSetter = [&onBundle](const char* bundle)
+    {
+        onBundle(bundle);
+    };
+    typedef LambdaDispatcher<decltype(userDataSetter), void, const char*> BundleSetter;
+
+    IntResult result = INVOKE_FUNC(GameKitListUserGameplayDataBundles, userGameplayDataInstance, (void*)&userDataSetter, BundleSetter::Dispatch);
+
+    if (result.Result != GameKit::GAMEKIT_SUCCESS)
+    {
+        result.ErrorMessage = FString("Error: AwsGameKitUserGameplayDataWrapper::GameKitListUserGameplayDataBundlesStreamed() Failed to retrieve data.");
+        const FString error = GameKit::StatusCodeToHexFStr(result.Result);
+        const FString message = result.ErrorMessage + " : " + error;
+        UE_LOG(LogAwsGameKit, Error, TEXT("%s"), *message);
+        return GameKit::GAMEKIT_ERROR_GENERAL;
+    }
+
+    return result.Result;
+}
+
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TMap<FString, FString>& inOutData, char* bundleName)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitGetUserGameplayDataBundle, GameKit::GAMEKIT_ERROR_GENERAL);
@@ -117,6 +141,30 @@ unsigned int AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle
     return result.Result;
 }
 
+unsigned int AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundleStreamed(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, TFunctionRef<void(const char* key, const char* value)> onItem)
+{
+    CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitGetUserGameplayDataBundle, GameKit::GAMEKIT_ERROR_GENERAL);
+
+    auto bundleSetter = [&onItem](const char* key, const char* value)
+    {
+        onItem(key, value);
+    };
+    typedef LambdaDispatcher<decltype(bundleSetter), void, const char*, const char*> BundleSetter;
+
+    IntResult result = INVOKE_FUNC(GameKitGetUserGameplayDataBundle, userGameplayDataInstance, bundleName, (void*)&bundleSetter, BundleSetter::Dispatch);
+
+    if (result.Result != GameKit::GAMEKIT_SUCCESS)
+    {
+        result.ErrorMessage = FString("Error: AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundleStreamed() Failed to retrieve data.");
+        const FString error = GameKit::StatusCodeToHexFStr(result.Result);
+        const FString message = result.ErrorMessage + " : " + error;
+        UE_LOG(LogAwsGameKit, Error, TEXT("%s"), *message);
+        return GameKit::GAMEKIT_ERROR_GENERAL;
+    }
+
+    return result.Result;
+}
+
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundleItem(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, FString& inOutData, UserGameplayDataBundleItem userGameplayDataBundleItem)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitGetUserGameplayDataBundleItem, GameKit::GAMEKIT_ERROR_GENERAL);
@@ -0,0 +1,223 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBuffer.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Core/AwsGameKitErrors.h"
+#include "UserGameplayData/AwsGameKitUserGameplayData.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/UObjectGlobals.h"
+
+TAutoConsoleVariable<float> CVarGameKitUserGameplayDataWriteBufferWindowSeconds(
+    TEXT("GameKit.UserGameplayData.WriteBuffer.WindowSeconds"),
+    2.0f,
+    TEXT("Seconds AwsGameKitUserGameplayData::UpdateItemBuffered() collects writes for before sending them. Writes to the same item in that time are sent once.\n")
+    TEXT(" <=0: every write is sent immediately\n"));
+
+TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataWriteBufferMaxItems(
+    TEXT("GameKit.UserGameplayData.WriteBuffer.MaxItems"),
+    100,
+    TEXT("Number of distinct bundle items buffered by AwsGameKitUserGameplayData::UpdateItemBuffered() that triggers a flush before the window ends.\n"));
+
+FAwsGameKitUserGameplayDataWriteBuffer& FAwsGameKitUserGameplayDataWriteBuffer::Get()
+{
+    static FAwsGameKitUserGameplayDataWriteBuffer WriteBuffer;
+    return WriteBuffer;
+}
+
+void FAwsGameKitUserGameplayDataWriteBuffer::Startup()
+{
+    check(IsInGameThread());
+    if (tickerHandle.IsValid())
+    {
+        return;
+    }
+
+    tickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitUserGameplayDataWriteBuffer::Tick));
+    preLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddRaw(this, &FAwsGameKitUserGameplayDataWriteBuffer::OnPreLoadMap);
+}
+
+void FAwsGameKitUserGameplayDataWriteBuffer::Shutdown()
+{
+    check(IsInGameThread());
+    if (!tickerHandle.IsValid())
+    {
+        return;
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(tickerHandle);
+    tickerHandle.Reset();
+    FCoreUObjectDelegates::PreLoadMap.Remove(preLoadMapHandle);
+    preLoadMapHandle.Reset();
+
+    FScopeLock scopeLock(&mutex);
+    if (itemCount > 0)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataWriteBuffer::Shutdown() Dropping %d buffered User Gameplay Data items that were never flushed."), itemCount);
+    }
+    bundles.Empty();
+    itemCount = 0;
+    coalescedCount = 0;
+    flushTime = 0.0;
+}
+
+void FAwsGameKitUserGameplayDataWriteBuffer::Write(const FUserGameplayDataBundleItemValue& Item, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+{
+    // Same as UpdateItem(), so GetBundle() and GetBundleItem() no longer serve the value from before this write
+    FAwsGameKitUserGameplayDataCache::Get().Invalidate(Item.BundleName);
+
+    const float windowSeconds = CVarGameKitUserGameplayDataWriteBufferWindowSeconds.GetValueOnAnyThread();
+    bool bFlushNow = false;
+    {
+        FScopeLock scopeLock(&mutex);
+
+        FBufferedBundle& bundle = bundles.FindOrAdd(Item.BundleName);
+        FBufferedItem* bufferedItem = bundle.Find(Item.BundleItemKey);
+        if (bufferedItem != nullptr)
+        {
+            coalescedCount++;
+        }
+        else
+        {
+            bufferedItem = &bundle.Add(Item.BundleItemKey);
+            itemCount++;
+        }
+
+        bufferedItem->Value = Item.BundleItemValue;
+        if (OnCompleteDelegate.IsBound())
+        {
+            bufferedItem->Delegates.Add(OnCompleteDelegate);
+        }
+
+        if (flushTime == 0.0)
+        {
+            flushTime = FPlatformTime::Seconds() + FMath::Max(windowSeconds, 0.0f);
+        }
+
+        bFlushNow = windowSeconds <= 0.0f || itemCount >= CVarGameKitUserGameplayDataWriteBufferMaxItems.GetValueOnAnyThread();
+    }
+
+    if (bFlushNow)
+    {
+        Flush();
+    }
+}
+
+void FAwsGameKitUserGameplayDataWriteBuffer::Flush()
+{
+    TMap<FString, FBufferedBundle> bundlesToSend;
+    {
+        FScopeLock scopeLock(&mutex);
+        if (itemCount == 0)
+        {
+            return;
+        }
+
+        UE_LOG(LogAwsGameKit, Verbose, TEXT("FAwsGameKitUserGameplayDataWriteBuffer::Flush() Sending %d items in %d bundles, %d writes were coalesced."), itemCount, bundles.Num(), coalescedCount);
+
+        bundlesToSend = MoveTemp(bundles);
+        bundles.Reset();
+        itemCount = 0;
+        coalescedCount = 0;
+        flushTime = 0.0;
+    }
+
+    for (TPair<FString, FBufferedBundle>& bundle : bundlesToSend)
+    {
+        SendBundle(bundle.Key, MoveTemp(bundle.Value));
+    }
+}
+
+void FAwsGameKitUserGameplayDataWriteBuffer::DiscardPlayerWrites()
+{
+    TMap<FString, FBufferedBundle> bundlesToDiscard;
+    {
+        FScopeLock scopeLock(&mutex);
+        if (itemCount == 0)
+        {
+            return;
+        }
+
+        UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitUserGameplayDataWriteBuffer::DiscardPlayerWrites() Dropping %d buffered items of the player who logged out."), itemCount);
+
+        bundlesToDiscard = MoveTemp(bundles);
+        bundles.Reset();
+        itemCount = 0;
+        coalescedCount = 0;
+        flushTime = 0.0;
+    }
+
+    const IntResult result(GameKit::GAMEKIT_ERROR_NO_ID_TOKEN);
+    for (const TPair<FString, FBufferedBundle>& bundle : bundlesToDiscard)
+    {
+        for (const TPair<FString, FBufferedItem>& item : bundle.Value)
+        {
+            for (const FAwsGameKitStatusDelegate& delegate : item.Value.Delegates)
+            {
+                InternalAwsGameKitRunDelegateOnGameThread(delegate, result);
+            }
+        }
+    }
+}
+
+int32 FAwsGameKitUserGameplayDataWriteBuffer::GetBufferedItemCount()
+{
+    FScopeLock scopeLock(&mutex);
+    return itemCount;
+}
+
+bool FAwsGameKitUserGameplayDataWriteBuffer::Tick(float DeltaTime)
+{
+    bool bDue = false;
+    {
+        FScopeLock scopeLock(&mutex);
+        bDue = flushTime != 0.0 && FPlatformTime::Seconds() >= flushTime;
+    }
+
+    if (bDue)
+    {
+        Flush();
+    }
+
+    return true;
+}
+
+void FAwsGameKitUserGameplayDataWriteBuffer::OnPreLoadMap(const FString& MapName)
+{
+    Flush();
+}
+
+void FAwsGameKitUserGameplayDataWriteBuffer::SendBundle(const FString& BundleName, FBufferedBundle&& Items)
+{
+    FUserGameplayDataBundle bundle;
+    bundle.BundleName = BundleName;
+    bundle.BundleMap.Reserve(Items.Num());
+    for (const TPair<FString, FBufferedItem>& item : Items)
+    {
+        bundle.BundleMap.Add(item.Key, item.Value.Value);
+    }
+
+    AwsGameKitUserGameplayData::AddBundle(bundle, TAwsGameKitDelegate<const IntResult&, const FUserGameplayDataBundle&>::CreateLambda(
+        [Items = MoveTemp(Items)](const IntResult& Result, const FUserGameplayDataBundle& UnprocessedItems)
+        {
+            // When the call failed without listing unprocessed items, none of them were written
+            const bool bAllFailed = Result.Result != GameKit::GAMEKIT_SUCCESS && UnprocessedItems.BundleMap.Num() == 0;
+            const IntResult success(GameKit::GAMEKIT_SUCCESS);
+            for (const TPair<FString, FBufferedItem>& item : Items)
+            {
+                const bool bFailed = bAllFailed || UnprocessedItems.BundleMap.Contains(item.Key);
+                for (const FAwsGameKitStatusDelegate& delegate : item.Value.Delegates)
+                {
+                    delegate.ExecuteIfBound(bFailed ? Result : success);
+                }
+            }
+        }));
+}
@@ -20,7 +20,7 @@
 class AWSGAMEKITRUNTIME_API AwsGameKitAchievements
 {
 private:
-    static AchievementsLibrary GetAchievementsLibraryFromModule();
+    static const AchievementsLibrary& GetAchievementsLibraryFromModule();
 public:
     /**
      * @brief Lists non-hidden achievements, and will call delegates after every page.
@@ -35,8 +35,9 @@ public:
      * - GAMEKIT_ERROR_NO_ID_TOKEN: The player is not logged in. You must login the player through the Identity & Authentication feature (AwsGameKitIdentity) before calling this method.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void ListAchievementsForPlayer(const FListAchievementsRequest& ListAchievementsRequest,
+    static FAwsGameKitOperationHandle ListAchievementsForPlayer(const FListAchievementsRequest& ListAchievementsRequest,
         TAwsGameKitDelegateParam<const TArray<FAchievement>&> PartialResultDelegate,
         FAwsGameKitStatusDelegateParam OperationCompleteDelegate);
 
@@ -52,12 +53,13 @@ public:
      * - GAMEKIT_ERROR_NO_ID_TOKEN: The player is not logged in. You must login the player through the Identity & Authentication feature (AwsGameKitIdentity) before calling this method.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void ListAchievementsForPlayer(TAwsGameKitDelegateParam<const IntResult&, const TArray<FAchievement>&> CombinedResultDelegate)
+    static FAwsGameKitOperationHandle ListAchievementsForPlayer(TAwsGameKitDelegateParam<const IntResult&, const TArray<FAchievement>&> CombinedResultDelegate)
     {
         const FListAchievementsRequest request = { 100, true };
         TAwsGameKitResultArrayGatherer<FAchievement> Gather(CombinedResultDelegate);
-        ListAchievementsForPlayer(request, Gather.OnResult(), Gather.OnStatus());
+        return ListAchievementsForPlayer(request, Gather.OnResult(), Gather.OnStatus());
     }
 
     /**
@@ -72,8 +74,9 @@ public:
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
      * - GAMEKIT_ERROR_ACHIEVEMENTS_INVALID_ID: The Achievement ID given is empty or malformed.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void GetAchievementForPlayer(const FGetAchievementRequest& GetAchievementRequest,
+    static FAwsGameKitOperationHandle GetAchievementForPlayer(const FGetAchievementRequest& GetAchievementRequest,
         TAwsGameKitDelegateParam<const IntResult&, const FAchievement&> ResultDelegate);
 
     /**
@@ -88,8 +91,9 @@ public:
      * - GAMEKIT_ERROR_NO_ID_TOKEN: The player is not logged in. You must login the player through the Identity & Authentication feature (AwsGameKitIdentity) before calling this method.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void UpdateAchievementForPlayer(const FUpdateAchievementRequest& UpdateAchievementRequest,
+    static FAwsGameKitOperationHandle UpdateAchievementForPlayer(const FUpdateAchievementRequest& UpdateAchievementRequest,
         TAwsGameKitDelegateParam<const IntResult&, const FAchievement&> ResultDelegate);
 
     /**
@@ -99,6 +103,7 @@ public:
      * The ::IntResult parameter is a GameKit status code and indicates the result of the API call.
      * Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void GetAchievementIconBaseUrl(TAwsGameKitDelegateParam<const IntResult&, const FString&> ResultDelegate);
+    static FAwsGameKitOperationHandle GetAchievementIconBaseUrl(TAwsGameKitDelegateParam<const IntResult&, const FString&> ResultDelegate);
 };
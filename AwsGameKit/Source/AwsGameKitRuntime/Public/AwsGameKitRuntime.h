@@ -14,11 +14,15 @@
 
 // Unreal
 #include "AwsGameKitUserGameplayDataStateHandler.h"
+#include "Models/AwsGameKitCommonModels.h"
 #include "Delegates/Delegate.h"
 #include "Modules/ModuleInterface.h"
 #include "Modules/ModuleManager.h"
 #include "Templates/SharedPointer.h"
 
+// Standard Library
+#include <atomic>
+
 #include "AwsGameKitRuntime.generated.h"
 
 struct CoreLibrary
@@ -62,6 +66,12 @@ struct UserGameplayDataLibrary
  */
 UDELEGATE(BlueprintCallable, Category = "AWS GameKit | User Gameplay Data | Network Status Change Delegate")
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FNetworkStatusChangeDelegate, bool, isConnectionOk, FString, connectionClient);
+
+/**
+ * @brief Broadcast on the game thread once the feature libraries requested by FAwsGameKitRuntimeModule::PreloadFeatureLibrariesAsync() are loaded.
+ */
+DECLARE_MULTICAST_DELEGATE(FOnAwsGameKitFeatureLibrariesReady);
+
 class AWSGAMEKITRUNTIME_API FAwsGameKitRuntimeModule : public IModuleInterface
 {
 private:
@@ -72,13 +82,32 @@ private:
     GameSavingLibrary gameSavingLibrary;
     UserGameplayDataLibrary userGameplayDataLibrary;
 
-    static FCriticalSection libLoadMutex;
+    // Set once the matching library above is fully initialized, so the getters can skip the load mutex afterwards
+    std::atomic<bool> identityLibraryLoaded { false };
+    std::atomic<bool> achievementsLibraryLoaded { false };
+    std::atomic<bool> gameSavingLibraryLoaded { false };
+    std::atomic<bool> userGameplayDataLibraryLoaded { false };
+
+    // One mutex per library, so libraries preloaded in parallel do not wait on each other
+    FCriticalSection identityLoadMutex;
+    FCriticalSection achievementsLoadMutex;
+    FCriticalSection gameSavingLoadMutex;
+    FCriticalSection userGameplayDataLoadMutex;
+
+    // Number of libraries requested by PreloadFeatureLibrariesAsync() that are not loaded yet
+    std::atomic<int32> pendingPreloads { 0 };
+    FOnAwsGameKitFeatureLibrariesReady onFeatureLibrariesReady;
+
+    // The started module, so feature calls do not look the module up by name
+    static std::atomic<FAwsGameKitRuntimeModule*> instance;
 
     bool initializeWrappers();
     void loadIdentityLibrary();
     void loadAchievementsLibrary();
     void loadGameSavingLibrary();
     void loadUserGameplayDataLibrary();
+    void loadFeatureLibrary(FeatureType_E feature);
+    void onPreloadComplete();
 
     // Delegate that notifies other objects about network state changes
     FNetworkStatusChangeDelegate onNetworkStatusChangeDelegate;
@@ -94,6 +123,14 @@ public:
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
 
+    /**
+     * @brief Get the AwsGameKitRuntime module.
+     *
+     * @details Unlike FModuleManager::GetModulePtr(), this does not look the module up by name once the module is started,
+     * so it is cheap enough to call on every feature call and safe to call from worker threads.
+     */
+    static FAwsGameKitRuntimeModule& Get();
+
     // ------ SessionManager methods ------
     /**
      * @brief Get the singleton GameKitSessionManager instance residing in the DLL.
@@ -120,12 +157,41 @@ public:
     bool ReloadConfigFile(const FString& subdirectory) const;
 
     // ------ Library Getters ------
-    CoreLibrary GetCoreLibrary();
-    SessionManagerLibrary GetSessionManagerLibrary();
-    IdentityLibrary GetIdentityLibrary();
-    AchievementsLibrary GetAchievementsLibrary();
-    GameSavingLibrary GetGameSavingLibrary();
-    UserGameplayDataLibrary GetUserGameplayDataLibrary();
+    // Feature libraries are loaded on first use. Once loaded, the getters do not lock and return a reference to the library owned by this module.
+    const CoreLibrary& GetCoreLibrary() const;
+    const SessionManagerLibrary& GetSessionManagerLibrary() const;
+    const IdentityLibrary& GetIdentityLibrary();
+    const AchievementsLibrary& GetAchievementsLibrary();
+    const GameSavingLibrary& GetGameSavingLibrary();
+    const UserGameplayDataLibrary& GetUserGameplayDataLibrary();
+
+    /**
+     * @brief Load every feature library now instead of on its first use, so the first call of each feature does not pay for loading the library.
+     */
+    void PreloadFeatureLibraries();
+
+    /**
+     * @brief Load the given feature libraries in parallel on the AWS GameKit worker threads, without blocking the caller.
+     *
+     * @details Each library is loaded on the executor lane of its feature, so calls of that feature made in the meantime run after it is loaded.
+     * OnFeatureLibrariesReady() is broadcast on the game thread once every requested library is loaded.
+     *
+     * StartupModule() calls this with the features listed in the GameKit.Startup.PreloadFeatures console variable.
+     *
+     * @param Features Features to load. Main and Authentication have no library of their own and are ignored.
+     */
+    void PreloadFeatureLibrariesAsync(const TArray<FeatureType_E>& Features);
+
+    /**
+     * @brief True when no library requested by PreloadFeatureLibrariesAsync() is still loading.
+     */
+    bool AreFeatureLibrariesReady() const;
+
+    /**
+     * @brief Broadcast on the game thread when the libraries requested by PreloadFeatureLibrariesAsync() are loaded.
+     * Check AreFeatureLibrariesReady() first, the event is not broadcast again for listeners added afterwards.
+     */
+    FOnAwsGameKitFeatureLibrariesReady& OnFeatureLibrariesReady();
 
     // Runtime delegates
     void SetNetworkChangeDelegate(const FNetworkStatusChangeDelegate& networkStatusChangeDelegate);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "AwsGameKitCore/Public/Core/AwsGameKitErrors.h"
+#include "Common/AwsGameKitOperationHandle.h"
 #include "Delegates/Delegate.h"
 
 /**
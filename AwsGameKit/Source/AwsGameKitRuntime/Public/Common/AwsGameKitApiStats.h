@@ -0,0 +1,107 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GameKit
+#include "Common/AwsGameKitExecutor.h"
+#include "Core/AwsGameKitNativeCallTiming.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/NameTypes.h"
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("API Calls"), STAT_AwsGameKitApiCalls, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("API Queue Wait (ms)"), STAT_AwsGameKitApiQueueWait, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("API Native Call (ms)"), STAT_AwsGameKitApiNativeCall, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("API Marshalling (ms)"), STAT_AwsGameKitApiMarshalling, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("API Game Thread Dispatch (ms)"), STAT_AwsGameKitApiGameThreadDispatch, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+
+/**
+ * @brief The parts an AWS GameKit API call's latency is split into.
+ */
+enum class EAwsGameKitApiPhase : uint8
+{
+    // From the API call until a worker thread starts the work
+    QueueWait,
+
+    // Time spent inside the GameKit libraries, excluding their callbacks into Unreal code
+    NativeCall,
+
+    // Time the worker spends outside the libraries: converting arguments and results between Unreal and GameKit types
+    Marshalling,
+
+    // From the worker posting a result until its delegate runs on the game thread
+    GameThreadDispatch,
+
+    Num
+};
+
+/**
+ * @brief Collects the latency of every AWS GameKit API, per API and per EAwsGameKitApiPhase.
+ *
+ * @details Each phase keeps its count, total and maximum since startup, and a window of the most recent samples
+ * for percentiles. The "GameKit.Stats" console command logs p50/p95/p99 per API; "GameKit.Stats reset" clears them.
+ * The same phases are also reported as STATGROUP_AwsGameKit counters and as Unreal Insights CPU scopes named after the API.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitApiStats
+{
+public:
+    static FAwsGameKitApiStats& Get();
+
+    /**
+     * @brief Record one sample. May be called from any thread.
+     *
+     * @param ApiName Name of the API, for example "Identity.Login".
+     */
+    void Record(const TCHAR* ApiName, EAwsGameKitApiPhase Phase, double Seconds);
+
+    /**
+     * @brief Log count, average, p50, p95, p99 and max of every phase of every API called since startup.
+     */
+    void DumpStats() const;
+
+    void Reset();
+
+private:
+    // Number of most recent samples kept per API and phase for percentiles
+    static constexpr int32 WindowSize = 512;
+
+    struct FPhaseSamples
+    {
+        TArray<float> Window;
+        int32 NextSample = 0;
+        uint64 Count = 0;
+        double TotalSeconds = 0.0;
+        double MaxSeconds = 0.0;
+    };
+
+    struct FApiSamples
+    {
+        FPhaseSamples Phases[(int32)EAwsGameKitApiPhase::Num];
+    };
+
+    TMap<FName, FApiSamples> apis;
+    mutable FCriticalSection mutex;
+};
+
+/**
+ * @brief Records the NativeCall and Marshalling phases of the work done on the calling thread during its lifetime.
+ *
+ * @details Native time is read from FAwsGameKitNativeCallTiming, so every INVOKE_FUNC made in the scope is counted,
+ * and callbacks made by the libraries into Unreal code are counted as marshalling.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitApiScope
+{
+public:
+    explicit FAwsGameKitApiScope(const TCHAR* InApiName);
+    ~FAwsGameKitApiScope();
+
+private:
+    const TCHAR* apiName;
+    double startTime;
+    double startNativeSeconds;
+    double startCallbackSeconds;
+};
@@ -6,15 +6,20 @@
 #include "Models/AwsGameKitCommonModels.h"
 
 // GameKit
+#include "Common/AwsGameKitExecutor.h"
+#include "Common/AwsGameKitOperationHandle.h"
 #include "Core/AwsGameKitErrors.h"
 
 // Unreal
-#include "Async/Async.h"
 #include "Containers/Queue.h"
 #include "Engine/LatentActionManager.h"
 #include "Engine/World.h"
 #include "LatentActions.h"
 #include "Misc/Optional.h"
+#include "Templates/Function.h"
+
+// Standard Library
+#include <atomic>
 
 UENUM()
 enum class EAwsGameKitSuccessOrFailureExecutionPin : uint8
@@ -28,6 +33,15 @@ struct TAwsGameKitInternalActionState
     FAwsGameKitOperationResult Err;
     ResultType Results;
     TOptional<TQueue<ResultType>> PartialResultsQueue;
+
+    // Optionally set by the threaded work, runs on the game thread right before Results are handed to Blueprint
+    TUniqueFunction<void(ResultType&)> CompleteOnGameThread;
+
+    // Set by the worker thread once the threaded work has returned
+    std::atomic<bool> bThreadedWorkComplete { false };
+
+    // Cancelled when the latent action is aborted or its callback target is destroyed
+    FAwsGameKitOperationStateRef Operation = MakeShared<FAwsGameKitOperationState, ESPMode::ThreadSafe>();
 };
 
 template <typename ResultType = FNoopStruct>
@@ -103,20 +117,49 @@ public:
     // and should stream partial result sets into ThreadedState->PartialResultsQueue if it is valid.
     // (If ThreadedState->PartialResultsQueue is not a valid object, it means that no partial-results
     // delegate was provided and there is no need to stream partial results via threadsafe queueing.)
+    // The work runs on the shared GameKit executor; when GameKit.Executor.MaxLatentActionsInFlight
+    // actions are already running, it waits in the executor's latent action queue.
     template <typename LambdaType>
     void LaunchThreadedWork(LambdaType&& Lambda)
     {
-        ThreadedResult = Async(EAsyncExecution::Thread, MoveTemp(Lambda));
+        check(!bLaunched);
+        bLaunched = true;
+
+        FAwsGameKitExecutor::Get().EnqueueLatentAction([State = ThreadedState, Work = Forward<LambdaType>(Lambda)]() mutable
+        {
+            // Skip the native call entirely if the action went away while it was queued
+            if (!State->Operation->IsAbandoned())
+            {
+                FAwsGameKitOperationState::FScope OperationScope(&State->Operation.Get());
+                Work();
+            }
+            State->bThreadedWorkComplete = true;
+        });
     }
 
 private:
+    // Nobody will read the results once the action is gone, let the threaded work skip marshalling them
+    virtual void NotifyObjectDestroyed() override
+    {
+        ThreadedState->Operation->Cancel();
+    }
+
+    virtual void NotifyActionAborted() override
+    {
+        ThreadedState->Operation->Cancel();
+    }
+
     // This override function is regularly called by the latent action manager
     virtual void UpdateOperation(FLatentResponse& Response) override
     {
-        check(ThreadedResult.IsValid()); // If this check fires, it means Launch was not called
-        if (ThreadedResult.IsReady())
+        check(bLaunched); // If this check fires, it means Launch was not called
+        if (ThreadedState->bThreadedWorkComplete)
         {
             DispatchPartialResults(PartialResultsDelegate, true);
+            if (ThreadedState->CompleteOnGameThread)
+            {
+                ThreadedState->CompleteOnGameThread(ThreadedState->Results);
+            }
             OutResults = MoveTemp(ThreadedState->Results);
             OutStatus = ThreadedState->Err;
             OutSuccessOrFailure = ThreadedState->Err.Status == GameKit::GAMEKIT_SUCCESS ? EAwsGameKitSuccessOrFailureExecutionPin::OnSuccess : EAwsGameKitSuccessOrFailureExecutionPin::OnFailure;
@@ -180,7 +223,7 @@ private:
     ResultType& OutResults;
     FAwsGameKitOperationResult& OutStatus;
     PartialResultsDelegateType PartialResultsDelegate;
-    TFuture<void> ThreadedResult;
+    bool bLaunched = false;
 };
 
 template <typename RequestType, typename ResultType, typename StreamingDelegateType = FNoopStruct>
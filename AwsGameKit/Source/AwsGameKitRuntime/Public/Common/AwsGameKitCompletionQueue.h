@@ -0,0 +1,80 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GameKit
+#include "Common/AwsGameKitExecutor.h"
+
+// Unreal
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Templates/Function.h"
+
+// Standard Library
+#include <atomic>
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Completion Queue Depth"), STAT_AwsGameKitCompletionQueueDepth, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Completions Delivered"), STAT_AwsGameKitCompletionsDelivered, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+
+/**
+ * @brief Delivers the results of AWS GameKit calls to the game thread.
+ *
+ * @details Worker threads push completions onto a lock-free multi-producer, single-consumer queue. The queue is
+ * drained on the game thread once per tick by the core ticker, so delivering results does not go through the task graph.
+ *
+ * Completions are delivered in the order they were pushed. Every call pushes its completions from a single worker
+ * thread, so the order of the delegates of one call is preserved.
+ *
+ * The time spent delivering completions in one frame is limited by GameKit.Completion.FrameBudgetMs.
+ * Whatever is left over is delivered on the next tick. At least one completion is delivered per tick.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitCompletionQueue
+{
+public:
+    /**
+     * @brief Get the completion queue shared by all AWS GameKit features.
+     */
+    static FAwsGameKitCompletionQueue& Get();
+
+    /**
+     * @brief Start draining the queue every tick. Called by the AwsGameKitRuntime module on startup.
+     */
+    void Startup();
+
+    /**
+     * @brief Stop draining the queue and drop any completions that were not delivered. Called by the AwsGameKitRuntime module on shutdown.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Queue Completion to run on the game thread. May be called from any thread.
+     *
+     * @details If the queue is not running (before module startup or after shutdown), Completion is sent to the game thread through the task graph instead.
+     */
+    void Enqueue(TUniqueFunction<void()>&& Completion);
+
+    /**
+     * @brief Run queued completions on the game thread until the queue is empty or BudgetSeconds have passed.
+     *
+     * @param BudgetSeconds Time budget. Zero or less drains the whole queue.
+     * @return Number of completions delivered.
+     */
+    int32 Drain(double BudgetSeconds);
+
+    /**
+     * @brief Number of completions waiting to be delivered.
+     */
+    int32 GetQueueDepth() const
+    {
+        return queueDepth;
+    }
+
+private:
+    bool Tick(float DeltaTime);
+
+    TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> queue;
+    std::atomic<int32> queueDepth { 0 };
+    std::atomic<bool> bRunning { false };
+    FTSTicker::FDelegateHandle tickerHandle;
+};
@@ -0,0 +1,151 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GameKit
+#include "Models/AwsGameKitCommonModels.h"
+
+// Unreal
+#include "Containers/Queue.h"
+#include "HAL/CriticalSection.h"
+#include "Stats/Stats.h"
+#include "Templates/Function.h"
+
+class FQueuedThreadPool;
+
+DECLARE_STATS_GROUP(TEXT("AWS GameKit"), STATGROUP_AwsGameKit, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Executor Queue Depth"), STAT_AwsGameKitExecutorQueueDepth, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Latent Action Queue Depth"), STAT_AwsGameKitLatentActionQueueDepth, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Latent Action Wait Time (ms)"), STAT_AwsGameKitLatentActionWaitTime, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+
+/**
+ * @brief Snapshot of the load on one lane of FAwsGameKitExecutor.
+ */
+struct FAwsGameKitExecutorLaneStats
+{
+    // Work currently running on a worker thread
+    int32 Running = 0;
+
+    // Work waiting because the lane is at its concurrency limit
+    int32 Queued = 0;
+
+    // Work handed to the pool since startup
+    uint64 Dispatched = 0;
+
+    // Time the most recently dispatched work spent waiting for a slot
+    double LastWaitSeconds = 0.0;
+
+    // Longest time any work spent waiting for a slot since startup
+    double MaxWaitSeconds = 0.0;
+
+    // Sum of the time all dispatched work spent waiting for a slot
+    double TotalWaitSeconds = 0.0;
+
+    double GetAverageWaitSeconds() const
+    {
+        return Dispatched > 0 ? TotalWaitSeconds / Dispatched : 0.0;
+    }
+};
+
+/**
+ * @brief Fixed-size worker pool that runs the blocking AWS GameKit feature calls.
+ *
+ * @details Work is grouped into lanes, and each lane has a concurrency limit:
+ * one lane per feature for the static feature APIs, plus one lane shared by all Blueprint latent actions.
+ * A burst of calls in one lane cannot occupy every worker and starve the others.
+ * For example, a loop of UpdateItem calls, or latent nodes placed in a Blueprint loop, stays within its own lane.
+ * Work submitted while its lane is at the limit waits in the lane's queue.
+ * It is handed to the pool when one of the lane's running calls returns.
+ *
+ * Pool size is read from GameKit.Executor.NumThreads when the AwsGameKitRuntime module starts.
+ * GameKit.Executor.MaxConcurrentPerFeature and GameKit.Executor.MaxLatentActionsInFlight are read on every submission.
+ * Use the GameKit.Executor.Dump console command to log the current lane statistics.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitExecutor
+{
+public:
+    /**
+     * @brief Get the executor shared by all AWS GameKit features.
+     */
+    static FAwsGameKitExecutor& Get();
+
+    /**
+     * @brief Create the worker threads. Called by the AwsGameKitRuntime module on startup.
+     */
+    void Startup();
+
+    /**
+     * @brief Abandon any queued work and join the worker threads. Called by the AwsGameKitRuntime module on shutdown.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Run Work on a worker thread, subject to the concurrency limit of Feature.
+     *
+     * @details If the executor is not running (before module startup or after shutdown), the work runs on a dedicated thread instead.
+     *
+     * @param Feature The feature the work belongs to. Each feature is limited independently.
+     * @param Work The work to run. It is called exactly once unless the executor is shut down before the work starts.
+     */
+    void Enqueue(FeatureType_E Feature, TUniqueFunction<void()>&& Work);
+
+    /**
+     * @brief Run the threaded part of a Blueprint latent action on a worker thread, subject to GameKit.Executor.MaxLatentActionsInFlight.
+     *
+     * @param Work The work to run. It is called exactly once unless the executor is shut down before the work starts.
+     */
+    void EnqueueLatentAction(TUniqueFunction<void()>&& Work);
+
+    /**
+     * @brief Number of submissions waiting for a free slot in their lane, across all lanes.
+     */
+    int32 GetQueueDepth() const;
+
+    /**
+     * @brief Get the load statistics of the lane of Feature.
+     */
+    FAwsGameKitExecutorLaneStats GetFeatureStats(FeatureType_E Feature) const;
+
+    /**
+     * @brief Get the load statistics of the Blueprint latent action lane.
+     */
+    FAwsGameKitExecutorLaneStats GetLatentActionStats() const;
+
+    /**
+     * @brief Write the statistics of every lane to the log.
+     */
+    void DumpStats() const;
+
+private:
+    class FWork;
+
+    struct FPendingWork
+    {
+        TUniqueFunction<void()> Function;
+        double EnqueueTime = 0.0;
+    };
+
+    struct FLane
+    {
+        FAwsGameKitExecutorLaneStats Stats;
+        TQueue<FPendingWork> PendingWork;
+    };
+
+    static constexpr int32 NumFeatureLanes = static_cast<int32>(FeatureType_E::UserGameplayData) + 1;
+    static constexpr int32 LatentActionLane = NumFeatureLanes;
+    static constexpr int32 NumLanes = NumFeatureLanes + 1;
+
+    static int32 GetFeatureLane(FeatureType_E Feature);
+    static int32 GetLaneLimit(int32 LaneIndex);
+
+    void EnqueueOnLane(int32 LaneIndex, TUniqueFunction<void()>&& Work);
+    void DispatchLocked(int32 LaneIndex, TUniqueFunction<void()>&& Work, double WaitSeconds);
+    void SetQueueDepthStatsLocked(int32 LaneIndex);
+    void OnWorkComplete(int32 LaneIndex);
+
+    FQueuedThreadPool* pool = nullptr;
+    FLane lanes[NumLanes];
+    int32 queueDepth = 0;
+    mutable FCriticalSection mutex;
+};
@@ -0,0 +1,158 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Unreal
+#include "HAL/PlatformTime.h"
+#include "Templates/SharedPointer.h"
+
+// Standard Library
+#include <atomic>
+
+/**
+ * @brief Shared state of one asynchronous AWS GameKit call, written by the caller and read by the worker thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitOperationState : public TSharedFromThis<FAwsGameKitOperationState, ESPMode::ThreadSafe>
+{
+public:
+    void Cancel()
+    {
+        bCancelled = true;
+    }
+
+    bool IsCancelled() const
+    {
+        return bCancelled;
+    }
+
+    void SetDeadline(double DeadlineSeconds)
+    {
+        deadline = DeadlineSeconds;
+    }
+
+    bool IsExpired() const
+    {
+        const double currentDeadline = deadline;
+        return currentDeadline > 0.0 && FPlatformTime::Seconds() >= currentDeadline;
+    }
+
+    /**
+     * @brief True when nobody is waiting for the result anymore, because the call was cancelled or its deadline passed.
+     */
+    bool IsAbandoned() const
+    {
+        return IsCancelled() || IsExpired();
+    }
+
+    /**
+     * @brief Name of the API that started the operation, used for FAwsGameKitApiStats. Set before the operation is shared with other threads.
+     */
+    void SetApiName(const TCHAR* InApiName)
+    {
+        apiName = InApiName;
+    }
+
+    const TCHAR* GetApiName() const
+    {
+        return apiName;
+    }
+
+    /**
+     * @brief The operation whose work is running on the calling thread, or nullptr outside of GameKit work.
+     */
+    static FAwsGameKitOperationState* GetCurrent();
+
+    /**
+     * @brief Sets the operation returned by GetCurrent() on this thread for the lifetime of the scope.
+     */
+    class AWSGAMEKITRUNTIME_API FScope
+    {
+    public:
+        explicit FScope(FAwsGameKitOperationState* Operation);
+        ~FScope();
+    private:
+        FAwsGameKitOperationState* previous;
+    };
+
+private:
+    std::atomic<bool> bCancelled { false };
+    std::atomic<double> deadline { 0.0 };
+    const TCHAR* apiName = nullptr;
+};
+
+typedef TSharedRef<FAwsGameKitOperationState, ESPMode::ThreadSafe> FAwsGameKitOperationStateRef;
+
+/**
+ * @brief Handle to an asynchronous AWS GameKit call, returned by every asynchronous feature API.
+ *
+ * @details A cancelled or expired call does not invoke its delegates. If the native call has not started yet,
+ * it is skipped entirely. If the native call is already running it is allowed to finish, because the GameKit
+ * libraries cannot be interrupted, but its results are not converted to Unreal types and nothing is posted
+ * to the game thread.
+ *
+ * Discarding the handle does not cancel the call.
+ *
+ * Example:
+ *   FAwsGameKitOperationHandle Handle = AwsGameKitGameSaving::LoadSlot(Request, Delegate);
+ *   Handle.SetTimeout(10.0);
+ *   ...
+ *   Handle.Cancel(); // e.g. when the player leaves the menu
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitOperationHandle
+{
+public:
+    FAwsGameKitOperationHandle()
+    {}
+
+    explicit FAwsGameKitOperationHandle(const FAwsGameKitOperationStateRef& InState)
+        : state(InState)
+    {}
+
+    /**
+     * @brief True if this handle refers to a call.
+     */
+    bool IsValid() const
+    {
+        return state.IsValid();
+    }
+
+    /**
+     * @brief Cancel the call. Its delegates will not be invoked after this returns, as long as this is called on the game thread.
+     */
+    void Cancel() const
+    {
+        if (state.IsValid())
+        {
+            state->Cancel();
+        }
+    }
+
+    bool IsCancelled() const
+    {
+        return state.IsValid() && state->IsCancelled();
+    }
+
+    /**
+     * @brief Give the call a deadline, measured from now. When it passes, the call behaves as if it was cancelled.
+     *
+     * @param TimeoutSeconds Seconds from now after which the result is dropped. Zero or less removes the deadline.
+     * @return This handle, so the call can be chained onto the API call.
+     */
+    const FAwsGameKitOperationHandle& SetTimeout(double TimeoutSeconds) const
+    {
+        if (state.IsValid())
+        {
+            state->SetDeadline(TimeoutSeconds > 0.0 ? FPlatformTime::Seconds() + TimeoutSeconds : 0.0);
+        }
+        return *this;
+    }
+
+    bool IsExpired() const
+    {
+        return state.IsValid() && state->IsExpired();
+    }
+
+private:
+    TSharedPtr<FAwsGameKitOperationState, ESPMode::ThreadSafe> state;
+};
@@ -8,6 +8,7 @@
 #include "AwsGameKitRuntimePublicHelpers.h"
 #include "Core/AwsGameKitErrors.h"
 #include "GameSaving/AwsGameKitGameSavingWrapper.h"
+#include "GameSaving/AwsGameKitSaveBufferPool.h"
 #include "Models/AwsGameKitGameSavingModels.h"
 #include "Utils/Blueprints/UAwsGameKitFileUtils.h"
 
@@ -57,7 +58,19 @@
 class AWSGAMEKITRUNTIME_API AwsGameKitGameSaving
 {
 private:
-    static GameSavingLibrary GetGameSavingLibraryFromModule();
+    // Receives the results of a slot action on the thread that ran it
+    typedef TFunctionRef<void(FGameSavingSlotActionResults& Results)> FSlotActionCompletion;
+
+    static const GameSavingLibrary& GetGameSavingLibraryFromModule();
+    static void RunAddLocalSlots(const TArray<FString>& LocalSlotInformationFilePaths);
+    static FAwsGameKitOperationHandle SaveSlotWithModel(ModelCache&& SaveSlotModel, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
+    static void RunSaveSlot(ModelCache& SaveSlotModel, FSlotActionCompletion OnComplete);
+    static void RunSaveSlotFromFile(const FGameSavingSaveSlotRequest& Request, const FString& SaveFilePath, TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate, FSlotActionCompletion OnComplete);
+    static void RunLoadSlotToFile(const FGameSavingLoadSlotRequest& Request, const FString& SaveFilePath, TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate, FSlotActionCompletion OnComplete);
+    static FAwsGameKitOperationHandle LoadSlotWithModel(ModelCache&& LoadSlotModel, TAwsGameKitDelegateParam<const IntResult&, FGameSavingDataResults&> ResultDelegate);
+    static bool IsSlotSynced(const char* SlotName, FGameSavingSlotActionResults& OutResults, FString& OutCloudDigest);
+
+    friend class UAwsGameKitGameSavingFunctionLibrary;
 
 public:
     /**
@@ -74,8 +87,23 @@ public:
      * @param ResultDelegate The delegate to invoke and return data to when the method has finished. The ::IntResult parameter is a GameKit status code and
      * indicates the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void AddLocalSlots(const FFilePaths& LocalSlotInformationFilePaths, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate);
+    static FAwsGameKitOperationHandle AddLocalSlots(const FFilePaths& LocalSlotInformationFilePaths, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate);
+
+    /**
+     * @brief Asynchronously load slot information for every SaveInfo.json file in a directory. Use this instead of AddLocalSlots() when all SaveInfo.json files are kept in one directory.
+     *
+     * @details The directory's FAwsGameKitSaveInfoIndex is read instead of each SaveInfo.json file: one read, plus one listing of the directory to check the files are unchanged.
+     * With the DefaultFileActions, the Game Saving library then reads the slot information from memory, and the index is kept up to date as slots are saved and loaded.
+     *
+     * @param SaveInfoDirectory The directory the SaveInfo.json files are written to, for example UAwsGameKitFileUtils::GetFeatureSaveDirectory(FeatureType_E::GameStateCloudSaving).
+     * @param ResultDelegate The delegate to invoke and return data to when the method has finished. The ::IntResult parameter is a GameKit status code and
+     * indicates the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: The API call was successful.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
+     */
+    static FAwsGameKitOperationHandle AddLocalSlotsFromDirectory(const FString& SaveInfoDirectory, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate);
 
     /**
      * @brief Asynchronously change the file I/O callbacks used by this library.
@@ -90,8 +118,9 @@ public:
      * @param ResultDelegate The delegate to invoke and return data to when the method has finished. The ::IntResult parameter is a GameKit status code and
      * indicates the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void SetFileActions(const FileActions& FileActions, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate);
+    static FAwsGameKitOperationHandle SetFileActions(const FileActions& FileActions, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate);
 
     /**
      * @brief Asynchronously get a complete and updated view of the player's save slots (both local and cloud).
@@ -113,8 +142,9 @@ public:
      * - GAMEKIT_ERROR_NO_ID_TOKEN: The player is not logged in. You must login the player through the Identity & Authentication feature (AwsGameKitIdentity) before calling this method.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void GetAllSlotSyncStatuses(TAwsGameKitDelegateParam<const IntResult&, const TArray<FGameSavingSlot>&> ResultDelegate);
+    static FAwsGameKitOperationHandle GetAllSlotSyncStatuses(TAwsGameKitDelegateParam<const IntResult&, const TArray<FGameSavingSlot>&> ResultDelegate);
 
     /**
      * @brief Asynchronously get an updated view and recommended syncing action for the player's specific save slot.
@@ -131,8 +161,9 @@ public:
      *                                             or the slot only exists in the cloud and you need to call GetAllSlotSyncStatuses() first before calling this method.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void GetSlotSyncStatus(const FGameSavingGetSlotSyncStatusRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
+    static FAwsGameKitOperationHandle GetSlotSyncStatus(const FGameSavingGetSlotSyncStatusRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
 
     /**
      * @brief Asynchronously delete the player's cloud save slot and remove it from the cached slots.
@@ -140,6 +171,7 @@ public:
      * @details No local files are deleted from the device. Data is only deleted from the cloud and from memory (the cached slot).
      *
      * @details After calling DeleteSlot(), you'll probably want to delete the local save file and corresponding SaveInfo.json file from the device.
+     * If the SaveInfo.json file is in a directory loaded with AddLocalSlotsFromDirectory(), also call FAwsGameKitSaveInfoIndex::Get().Remove() with its path.
      * If you keep the SaveInfo.json file, then next time the game boots up this library will recommend re-uploading the save file to the cloud when
      * you call GetAllSlotSyncStatuses() or GetSlotSyncStatus().
      *
@@ -156,8 +188,9 @@ public:
      *                                             or the slot only exists in the cloud and you need to call GetAllSlotSyncStatuses() first before calling this method.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void DeleteSlot(const FGameSavingDeleteSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
+    static FAwsGameKitOperationHandle DeleteSlot(const FGameSavingDeleteSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
 
     /**
      * @brief Asynchronously upload a data buffer to the cloud, overwriting the player's cloud slot if it already exists.
@@ -188,8 +221,27 @@ public:
      *                                                  GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT because the local and cloud save might have non-overlapping game progress.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void SaveSlot(const FGameSavingSaveSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
+    static FAwsGameKitOperationHandle SaveSlot(const FGameSavingSaveSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
+
+    /**
+     * @brief Same as SaveSlot(const FGameSavingSaveSlotRequest&, ...), but takes ownership of the request.
+     *
+     * @details Request.Data is moved all the way to the low level C API and the file I/O callbacks without being copied.
+     * Prefer this overload for large save files: call it with MoveTemp(Request).
+     */
+    static FAwsGameKitOperationHandle SaveSlot(FGameSavingSaveSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
+
+    /**
+     * @brief Same as SaveSlot(const FGameSavingSaveSlotRequest&, ...), but uploads a buffer shared with the caller instead of Request.Data.
+     *
+     * @details Data is read in place and is not copied. It must not be modified until ResultDelegate is invoked. Leave Request.Data empty,
+     * it is ignored but would still be copied along with the rest of the request.
+     *
+     * @param Data The save file to upload.
+     */
+    static FAwsGameKitOperationHandle SaveSlot(const FGameSavingSaveSlotRequest& Request, const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>& Data, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
 
     /**
      * @brief Asynchronously download the player's cloud slot into a local data buffer.
@@ -224,8 +276,85 @@ public:
      *                                               call GetSlotSyncStatus() to get the up-to-date size of the cloud file.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
+     */
+    static FAwsGameKitOperationHandle LoadSlot(const FGameSavingLoadSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&> ResultDelegate);
+
+    /**
+     * @brief Same as LoadSlot(const FGameSavingLoadSlotRequest&, ...), but downloads straight into Request.Data and hands that buffer to the delegate.
+     *
+     * @details Request.Data is moved into the call, filled by the download, trimmed to the size of the save and moved into FGameSavingDataResults::Data,
+     * so only one buffer the size of the save exists at any time. The delegate receives the results by non-const reference and may move Data out.
+     *
+     * @details Request.Data can be taken from FAwsGameKitSaveBufferPool::Acquire() and given back with FAwsGameKitSaveBufferPool::Release() once the save is deserialized.
+     */
+    static FAwsGameKitOperationHandle LoadSlot(FGameSavingLoadSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, FGameSavingDataResults&> ResultDelegate);
+
+    /**
+     * @brief Asynchronously upload a save file from the device to the cloud, reading it in chunks.
+     *
+     * @details Same as SaveSlot(), but the save file is read from SaveFilePath instead of Request.Data, which is ignored and should be left empty.
+     * The file is read directly into one buffer from FAwsGameKitSaveBufferPool, GameKit.GameSaving.StreamChunkKB at a time, with a progress report after every chunk.
+     * The buffer is returned to the pool once the upload finishes. The game never needs its own copy of the save in memory.
+     * When GameKit.GameSaving.MapSaveFiles is enabled and the platform supports it, the file is instead mapped into memory with FAwsGameKitMappedSaveFile
+     * and uploaded from the mapping, with no buffer or copy at all, and no READING_FILE progress. The game must not write the file until the delegate is invoked:
+     * truncating a mapped file crashes the process on POSIX platforms, and writing it fails with a sharing violation on Windows. The CVar is disabled by default.
+     *
+     * @details The upload is done by the GameKit library in a single request, which only reports progress when it starts.
+     * The whole file must be held in memory while it is uploaded, so save files are limited to 2 GB.
+     *
+     * @param Request A struct containing all parameters required to call this method, except Data.
+     * @param SaveFilePath The absolute path of the save file to upload.
+     * @param ProgressDelegate (Optional) Invoked on the game thread as the transfer progresses.
+     * @param ResultDelegate The delegate to invoke and return data to when the method has finished. The status codes are the same as SaveSlot(), plus:
+     * - GAMEKIT_ERROR_FILE_OPEN_FAILED: The save file could not be opened.
+     * - GAMEKIT_ERROR_FILE_READ_FAILED: The save file could not be read.
+     * - GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE: The save file is larger than 2 GB.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
+     */
+    static FAwsGameKitOperationHandle SaveSlotFromFile(const FGameSavingSaveSlotRequest& Request, const FString& SaveFilePath, TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
+
+    /**
+     * @brief Asynchronously download the player's cloud slot to a save file on the device, writing it in chunks.
+     *
+     * @details Same as LoadSlot(), but the save file is written to SaveFilePath instead of being returned. Request.Data is ignored and should be left empty.
+     * The size of the cloud file is looked up with GetSlotSyncStatus() first, then it is downloaded into one buffer from FAwsGameKitSaveBufferPool
+     * and written to the file GameKit.GameSaving.StreamChunkKB at a time, with a progress report after every chunk.
+     *
+     * @details The download is done by the GameKit library in a single request, which only reports progress when it starts and when it finishes.
+     * Save files are limited to 2 GB.
+     *
+     * @param Request A struct containing all parameters required to call this method, except Data.
+     * @param SaveFilePath The absolute path to write the save file to. An existing file is only replaced once the download is completely written and flushed,
+     * so a cancelled or failed call leaves it unchanged.
+     * @param ProgressDelegate (Optional) Invoked on the game thread as the transfer progresses.
+     * @param ResultDelegate The delegate to invoke and return data to when the method has finished. The status codes are the same as LoadSlot() and GetSlotSyncStatus(), plus:
+     * - GAMEKIT_ERROR_FILE_WRITE_FAILED: The save file could not be written.
+     * - GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE: The cloud file is larger than 2 GB.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
+     */
+    static FAwsGameKitOperationHandle LoadSlotToFile(const FGameSavingLoadSlotRequest& Request, const FString& SaveFilePath, TAwsGameKitDelegateParam<const FGameSavingTransferProgress&> ProgressDelegate, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
+
+    /**
+     * @brief Asynchronously bring every slot in sync with the cloud: upload newer local saves and download newer cloud saves, several at a time.
+     *
+     * @details Calls GetAllSlotSyncStatuses() once, then for each slot:
+     * - SHOULD_UPLOAD_LOCAL: uploads the local save file, like SaveSlotFromFile(), keeping the slot's local metadata and using the file's last modified time.
+     * - SHOULD_DOWNLOAD_CLOUD: downloads the cloud save to the local save file, like LoadSlotToFile().
+     * - IN_CONFLICT: not transferred, the slot is reported in FGameSavingSyncAllSlotsResults::Conflicts for the game to resolve.
+     * - SYNCED: nothing to do.
+     *
+     * @details Up to Request.MaxConcurrentTransfers slots are transferred at the same time, on the Game Saving lane of FAwsGameKitExecutor, so
+     * GameKit.Executor.MaxConcurrentPerFeature also limits them. Cancelling the returned handle stops starting new transfers; transfers already running finish first.
+     *
+     * @param Request Where the local save files are, see FGameSavingSyncAllSlotsRequest.
+     * @param ProgressDelegate (Optional) Invoked on the game thread each time a slot finishes transferring.
+     * @param ResultDelegate The delegate to invoke and return data to when every transfer has finished. The status codes are:
+     * - GAMEKIT_SUCCESS: Every upload and download succeeded. There may still be Conflicts.
+     * - Any status code of GetAllSlotSyncStatuses(), SaveSlotFromFile() or LoadSlotToFile(): the status of the first failure, see FailedSlots.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void LoadSlot(const FGameSavingLoadSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&> ResultDelegate);
+    static FAwsGameKitOperationHandle SyncAllSlots(const FGameSavingSyncAllSlotsRequest& Request, TAwsGameKitDelegateParam<const FGameSavingSyncProgress&> ProgressDelegate, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSyncAllSlotsResults&> ResultDelegate);
 
     /**
      * @brief Get the recommended file extension for SaveInfo JSON files.
@@ -208,6 +208,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Game Saving")
     static FString EpochToHumanReadable(int64 epochTimeMilliseconds);
 
+    /**
+     * Get the cached slots as last reported by the Game Saving nodes, and the version of that set.
+     *
+     * Use this instead of the Slots of a node's results when GameKit.GameSaving.SlimResults is set. The set only changed if SlotsVersion differs from the last one seen.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Game Saving")
+    static void GetCachedSlots(TArray<FGameSavingSlot>& Slots, int64& SlotsVersion);
+
     /**
      * Get the recommended file extension for SaveInfo JSON files.
      *
@@ -97,47 +97,72 @@ typedef unsigned int(*FileGetSizeCallback)(DISPATCH_RECEIVER_HANDLE dispatchRece
  * @brief This class provides the default file I/O methods used by the Game Saving library.
  *
  * @details It uses Unreal-provided file I/O methods and may not work on all platforms.
- * Specifically, it uses the Unreal FFileHelper and IFileManager classes.
+ * Specifically, it uses the Unreal IPlatformFile and IFileManager classes.
  * You can call AwsGameKitGameSaving::SetFileActions() to provide your own file I/O methods which support the necessary platform(s).
+ *
+ * Files are written atomically: a crash while saving leaves either the previous file or the new one, never a truncated file.
+ * The methods keep no shared state, so calls for different slots running on different threads overlap their I/O.
+ * SaveInfo.json files in a directory loaded by FAwsGameKitSaveInfoIndex are read from the index, and the index is updated when they are written.
  */
 class DefaultFileActions : public FileActions
 {
 public:
     DefaultFileActions();
 
+    /**
+     * @brief The path a new version of filePath is written to before commitDesktopFile() renames it over filePath.
+     */
+    static FString getTempFilePath(const FString& filePath);
+
+    /**
+     * @brief Replace filePath with the file at getTempFilePath(filePath), which must be completely written and flushed.
+     *
+     * @details The temp file is renamed to "<filePath>.new" and then over filePath, see writeDesktopFile(). The temp file is deleted if it cannot be renamed.
+     *
+     * @return True if filePath now holds the new file.
+     */
+    static bool commitDesktopFile(const FString& filePath);
+
 private:
     /**
      * @brief Save a byte array to a file, overwriting the file if it already exists.
      *
-     * @details Uses the Unreal FFileHelper::SaveArrayToFile() method.
+     * @details The data is written to "<filePath>.tmp" and flushed to disk, then renamed to "<filePath>.new" and finally over filePath.
+     * If the last rename is interrupted, recoverDesktopFile() completes it the next time the file is read.
      *
      * @param filePath The absolute or relative path of the file to write to.
      * @param data The data to write to the file.
      * @return True if the data was successfully written to the file, false otherwise.
      */
-    static bool writeDesktopFile(const FString& filePath, const TArray<uint8>& data);
+    static bool writeDesktopFile(const FString& filePath, TArrayView<const uint8> data);
 
     /**
-     * @brief Load a file into a byte array, resizing the array as needed, with two uninitialized bytes at the end as padding.
+     * @brief Load a file into a buffer the caller has already allocated.
      *
-     * @details Uses the Unreal FFileHelper::LoadFileToArray() method.
+     * @details Uses an Unreal IAsyncReadFileHandle. The file is read directly into the buffer in blocks which are all requested at once.
      *
      * @param filePath The absolute or relative path of the file to read from.
-     * @param data The array to store the data in. The array will be re-sized to hold the contents of the file, plus will have two uninitialized bytes at the end as padding.
+     * @param data The buffer to store the data in.
+     * @param size The size of the buffer in bytes. Reading fails if the file is larger.
      * @return True if the data was successfully read from the file, false otherwise.
      */
-    static bool readDesktopFile(const FString& filePath, TArray<uint8>& data);
+    static bool readDesktopFile(const FString& filePath, uint8* data, int64 size);
 
     /**
      * @brief Return the size of the file in bytes, or 0 if the file does not exist.
      *
-     * @details Uses the Unreal methods IFileManager::FileExists() and IFileManager::FileSize().
+     * @details Uses the Unreal method IFileManager::FileSize().
      *
      * @param filePath The absolute or relative path of the file to check.
      * @return The file size in bytes, or 0 if the file does not exist.
      */
     static int64 getDesktopFileSize(const FString& filePath);
 
+    /**
+     * @brief Rename "<filePath>.new" to filePath if a previous writeDesktopFile() was interrupted before it could.
+     */
+    static void recoverDesktopFile(const FString& filePath);
+
     /**
      * @brief A callback function that meets the signature of FileWriteCallback. Internally calls DefaultFileActions::writeDesktopFile().
      */
@@ -150,6 +175,8 @@ private:
 
     /**
      * @brief A callback function that meets the signature of FileGetSizeCallback. Internally calls DefaultFileActions::getDesktopFileSize().
+     *
+     * @details Files of 4 GB or more are reported as MAX_uint32 bytes, so reading them fails instead of returning part of the file.
      */
     static unsigned int getFileSizeCallback(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath);
 };
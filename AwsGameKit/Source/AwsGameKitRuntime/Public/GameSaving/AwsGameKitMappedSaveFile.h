@@ -0,0 +1,54 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Unreal
+#include "Containers/ArrayView.h"
+#include "Containers/UnrealString.h"
+#include "Templates/UniquePtr.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * @brief A local save file mapped into memory, read only.
+ *
+ * @details The file's bytes are paged in by the OS as they are accessed, without a heap allocation or a copy.
+ * Typical use when loading a local save, for example on a load screen:
+ * - TUniquePtr<FAwsGameKitMappedSaveFile> SaveFile = FAwsGameKitMappedSaveFile::Open(SaveFilePath);
+ * - Deserialize directly from SaveFile->GetData(), for example with an FMemoryReaderView, after checking GetCrc32() if the game stores a checksum.
+ *
+ * The data stays valid until the object is destroyed, as long as the file is not truncated: on POSIX platforms accessing a page past the new end of the
+ * file raises SIGBUS. AwsGameKitGameSaving::SaveSlotFromFile() also uploads from a mapped file when GameKit.GameSaving.MapSaveFiles is enabled.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitMappedSaveFile
+{
+public:
+    /**
+     * @brief Map a file into memory.
+     *
+     * @return Null if the file does not exist, is empty or larger than 2 GB, or the platform cannot map files. Read the file normally then.
+     */
+    static TUniquePtr<FAwsGameKitMappedSaveFile> Open(const FString& FilePath);
+
+    ~FAwsGameKitMappedSaveFile();
+
+    TArrayView<const uint8> GetData() const
+    {
+        return data;
+    }
+
+    /**
+     * @brief CRC32 of the file, computed in place on the mapped bytes.
+     */
+    uint32 GetCrc32() const;
+
+private:
+    FAwsGameKitMappedSaveFile(TUniquePtr<IMappedFileHandle>&& Handle, TUniquePtr<IMappedFileRegion>&& Region);
+
+    // The region must be released before the handle it was mapped from
+    TUniquePtr<IMappedFileHandle> mappedHandle;
+    TUniquePtr<IMappedFileRegion> mappedRegion;
+    TArrayView<const uint8> data;
+};
@@ -0,0 +1,47 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief A pool of byte buffers for save files, so loading a save does not allocate a new buffer every time.
+ *
+ * @details Typical use with AwsGameKitGameSaving::LoadSlot():
+ * - Request.Data = FAwsGameKitSaveBufferPool::Get().Acquire(Slot.SizeCloud);
+ * - LoadSlot(MoveTemp(Request), ...). The buffer is downloaded into and handed to the delegate in FGameSavingDataResults::Data.
+ * - Once the game has deserialized the save: FAwsGameKitSaveBufferPool::Get().Release(MoveTemp(Results.Data));
+ *
+ * The number and total size of pooled buffers is limited by GameKit.GameSaving.BufferPool.MaxBuffers and GameKit.GameSaving.BufferPool.MaxMB.
+ * All methods may be called from any thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitSaveBufferPool
+{
+public:
+    static FAwsGameKitSaveBufferPool& Get();
+
+    /**
+     * @brief Get a buffer of Size bytes. Its contents are uninitialized.
+     *
+     * @details Reuses the smallest pooled buffer that is large enough, otherwise allocates a new one.
+     */
+    TArray<uint8> Acquire(int32 Size);
+
+    /**
+     * @brief Give a buffer back to the pool. It is freed instead if the pool is full.
+     */
+    void Release(TArray<uint8>&& Buffer);
+
+    /**
+     * @brief Free every pooled buffer.
+     */
+    void Trim();
+
+private:
+    TArray<TArray<uint8>> buffers;
+    int64 pooledBytes = 0;
+    FCriticalSection mutex;
+};
@@ -0,0 +1,60 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/UnrealString.h"
+#include "UObject/NameTypes.h"
+
+/**
+ * @brief Compresses save files for the Game Saving feature, see FGameSavingSaveSlotRequest::Compression.
+ *
+ * @details A compressed save starts with a small header naming the FCompression format, the uncompressed size, and the compressed size of each chunk.
+ * The save is split into chunks of GameKit.GameSaving.CompressionChunkKB which are compressed and decompressed in parallel on the task graph.
+ *
+ * The compression format and uncompressed size are also recorded in the slot's metadata, and so in its SaveInfo.json file,
+ * with a tag that FGameSavingSlot strips before the metadata reaches the game. Loading decides from that tag whether a save is compressed;
+ * the header only validates it, so an uncompressed save is returned as is whatever bytes it starts with.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitSaveCompression
+{
+public:
+    /**
+     * @brief Compress RawData with the FCompression format FormatName, for example NAME_Zlib, NAME_LZ4 or NAME_Oodle.
+     *
+     * @return False if the format is not available or compression failed. OutCompressed is not valid then.
+     */
+    static bool Compress(FName FormatName, TArrayView<const uint8> RawData, TArray<uint8>& OutCompressed);
+
+    /**
+     * @brief Decompress data written by Compress().
+     *
+     * @param FormatName The format recorded in the slot's metadata, see ReadMetadataTag(). Data whose header names another format is rejected.
+     * @param RawSize The uncompressed size recorded in the slot's metadata. Data whose header records another size is rejected.
+     * @return False if Data is not compressed, is corrupt, does not match the metadata, or its format is not available.
+     */
+    static bool Decompress(TArrayView<const uint8> Data, FName FormatName, int64 RawSize, TArray<uint8>& OutRaw);
+
+    /**
+     * @brief Prefix Metadata with a tag recording the compression format and uncompressed size of a save.
+     */
+    static FString TagMetadata(const FString& Metadata, FName FormatName, int64 RawSize);
+
+    /**
+     * @brief Read the tag added by TagMetadata().
+     *
+     * @return False if Metadata has no tag, which means the save was not compressed.
+     */
+    static bool ReadMetadataTag(const FString& Metadata, FName& OutFormatName, int64& OutRawSize);
+
+    /**
+     * @brief Remove the tag added by TagMetadata(), if any.
+     *
+     * @param OutRawSize Set to the uncompressed size from the tag, left unchanged if there is no tag.
+     * @return The metadata the game provided.
+     */
+    static FString UntagMetadata(const FString& Metadata, int64& OutRawSize);
+};
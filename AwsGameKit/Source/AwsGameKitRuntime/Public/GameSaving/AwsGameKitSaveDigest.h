@@ -0,0 +1,48 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Unreal
+#include "Containers/ArrayView.h"
+#include "Containers/UnrealString.h"
+#include "UObject/NameTypes.h"
+
+/**
+ * @brief Identifies the content of a save upload, see FGameSavingSaveSlotRequest::SkipUploadIfUnchanged.
+ *
+ * @details The digest is a SHA-1 of the uncompressed save file, the game's metadata, the epoch time and the compression format of a SaveSlot call.
+ * It is recorded in the slot's metadata, and so in its SaveInfo.json file and the cloud save, with a tag that FGameSavingSlot strips before
+ * the metadata reaches the game. The digest tag follows the compression tag, see FAwsGameKitSaveCompression::TagMetadata().
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitSaveDigest
+{
+public:
+    /**
+     * @brief Compute the digest of a save upload. Hashes the whole save file, so call on a worker thread.
+     *
+     * @param RawData The save file before compression.
+     * @param Metadata The metadata the game provided, without tags.
+     * @return The digest as 40 hexadecimal characters.
+     */
+    static FString Compute(TArrayView<const uint8> RawData, const FString& Metadata, int64 EpochTime, FName CompressionFormat);
+
+    /**
+     * @brief Prefix Metadata with a tag recording Digest. Tag the result for compression afterwards, if the save is compressed.
+     */
+    static FString TagMetadata(const FString& Metadata, const FString& Digest);
+
+    /**
+     * @brief Read the tag added by TagMetadata() from a slot's metadata, skipping a compression tag before it.
+     *
+     * @return The digest, or an empty string if the save was uploaded without SkipUploadIfUnchanged.
+     */
+    static FString ReadMetadataTag(const FString& Metadata);
+
+    /**
+     * @brief Remove the tag added by TagMetadata(), if any. Remove the compression tag first.
+     *
+     * @return The metadata the game provided.
+     */
+    static FString UntagMetadata(const FString& Metadata);
+};
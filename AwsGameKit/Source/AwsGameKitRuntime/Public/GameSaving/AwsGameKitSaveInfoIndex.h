@@ -0,0 +1,81 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/DateTime.h"
+
+/**
+ * @brief A binary index of the SaveInfo.json files in a directory, so AwsGameKitGameSaving::AddLocalSlotsFromDirectory() registers every local slot from one read.
+ *
+ * @details The index is stored as SaveInfoIndex.bin in the directory it describes, usually UAwsGameKitFileUtils::GetFeatureSaveDirectory().
+ * It holds the contents and modification time of every SaveInfo.json file in the directory. LoadDirectory() reads it, lists the directory once to check
+ * each entry's modification time, re-reads only the files that changed, and drops the ones that were deleted. DefaultFileActions then serves the
+ * Game Saving library's reads of those files from memory instead of opening each one.
+ *
+ * Once a directory is loaded, DefaultFileActions keeps its index up to date whenever the Game Saving library writes a SaveInfo.json file to it. Each change is
+ * appended to the index file; the file is compacted the next time it is loaded. Call Remove() after deleting a SaveInfo.json file yourself, see AwsGameKitGameSaving::DeleteSlot().
+ *
+ * All methods may be called from any thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitSaveInfoIndex
+{
+public:
+    static FAwsGameKitSaveInfoIndex& Get();
+
+    static FString GetIndexPath(const FString& Directory);
+
+    /**
+     * @brief Load the index of Directory, bring it up to date with the SaveInfo.json files in the directory, and keep it up to date from now on.
+     *
+     * @return The paths of every SaveInfo.json file in Directory.
+     */
+    TArray<FString> LoadDirectory(const FString& Directory);
+
+    /**
+     * @brief Record that the SaveInfo.json file FilePath was written with Contents. Does nothing unless its directory was loaded.
+     */
+    void Update(const FString& FilePath, TArrayView<const uint8> Contents);
+
+    /**
+     * @brief Record that the SaveInfo.json file FilePath was deleted.
+     */
+    void Remove(const FString& FilePath);
+
+    /**
+     * @return The size of the indexed SaveInfo.json file FilePath, or INDEX_NONE if it is not indexed.
+     */
+    int64 GetSize(const FString& FilePath);
+
+    /**
+     * @brief Copy the contents of the indexed SaveInfo.json file FilePath into Data.
+     *
+     * @return False if the file is not indexed or is larger than Size.
+     */
+    bool Read(const FString& FilePath, uint8* Data, int64 Size);
+
+private:
+    struct FEntry
+    {
+        FDateTime Timestamp;
+        TArray<uint8> Contents;
+    };
+
+    typedef TMap<FString, FEntry> FDirectoryIndex;
+
+    // Returns the loaded index of FilePath's directory, or nullptr. Call with the mutex held.
+    FDirectoryIndex* FindDirectory(const FString& FilePath, FString& OutDirectory, FString& OutFileName);
+
+    static bool WriteIndex(const FString& Directory, const FDirectoryIndex& Index);
+    static void AppendRecord(const FString& Directory, const TArray<uint8>& Record);
+
+    // Indexes by full directory path, then by SaveInfo.json file name
+    TMap<FString, FDirectoryIndex> directories;
+    FCriticalSection mutex;
+};
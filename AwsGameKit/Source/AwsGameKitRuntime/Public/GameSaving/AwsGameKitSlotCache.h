@@ -0,0 +1,83 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GameKit
+#include "Models/AwsGameKitGameSavingModels.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+
+/**
+ * @brief The game thread's copy of the cached slots, kept up to date from the slot acted on by each AwsGameKitGameSaving call.
+ *
+ * @details Every call that acts on a single slot applies that slot here before its delegate runs, DeleteSlot() removes it,
+ * and GetAllSlotSyncStatuses() and SyncAllSlots() replace the whole set. The version is bumped whenever a slot actually changes
+ * and is returned to the delegate in FGameSavingSlotActionResults::SlotsVersion and FGameSavingDataResults::SlotsVersion,
+ * so a game only has to re-read its slot list when the version moved.
+ *
+ * When GameKit.GameSaving.SlimResults is set, the results of single-slot calls no longer carry a copy of every cached slot
+ * (their Slots field is empty) and this cache is the place to read them from.
+ *
+ * Apart from IsSlimResultsEnabled() and FillResults(), all methods must be called on the game thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitSlotCache
+{
+public:
+    static FAwsGameKitSlotCache& Get();
+
+    /**
+     * @brief True if single-slot results should only carry the acted on slot, see GameKit.GameSaving.SlimResults.
+     */
+    static bool IsSlimResultsEnabled();
+
+    /**
+     * @brief Fill the slots of a FGameSavingSlotActionResults or FGameSavingDataResults from a Game Saving callback.
+     *
+     * This method is used internally and you probably won't need to use this.
+     */
+    template <typename ResultsType>
+    static void FillResults(ResultsType& Results, const Slot* CachedSlots, unsigned int SlotCount, const Slot* ActedOnSlot)
+    {
+        if (!IsSlimResultsEnabled())
+        {
+            Results.Slots.Slots = FGameSavingSlot::ToArray(CachedSlots, SlotCount);
+        }
+
+        Results.ActedOnSlot = FGameSavingSlot::From(*ActedOnSlot);
+    }
+
+    /**
+     * @return The cached slot named SlotName, or nullptr if there is none.
+     */
+    const FGameSavingSlot* Find(const FString& SlotName) const;
+
+    const TMap<FString, FGameSavingSlot>& GetSlots() const;
+
+    int64 GetVersion() const;
+
+    /**
+     * @brief Add or replace a slot. Slots without a name (the acted on slot of a failed call) are ignored.
+     *
+     * @return The version after the update.
+     */
+    int64 Update(const FGameSavingSlot& Slot);
+
+    /**
+     * @return The version after the removal.
+     */
+    int64 Remove(const FString& SlotName);
+
+    /**
+     * @brief Replace every cached slot.
+     *
+     * @return The version after the reset.
+     */
+    int64 Reset(const TArray<FGameSavingSlot>& Slots);
+
+private:
+    TMap<FString, FGameSavingSlot> slots;
+    int64 version = 0;
+};
@@ -52,7 +52,7 @@
 class AWSGAMEKITRUNTIME_API AwsGameKitIdentity
 {
 private:
-    static IdentityLibrary GetIdentityLibraryFromModule();
+    static const IdentityLibrary& GetIdentityLibraryFromModule();
 
 public:
     /**
@@ -68,8 +68,9 @@ public:
      * - GAMEKIT_ERROR_MALFORMED_PASSWORD: The provided Password is malformed. Check the output logs to see what the required format is.
      * - GAMEKIT_ERROR_METHOD_NOT_IMPLEMENTED: You attempted to register a guest, which is not yet supported. To fix, make sure the request's FUserRegistrationRequest::UserId field is empty.
      * - GAMEKIT_ERROR_REGISTER_USER_FAILED: The backend web request failed. Check the output logs to see what the error was.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void Register(const FUserRegistrationRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle Register(const FUserRegistrationRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Confirm registration of a new player that was registered through Register().
@@ -82,8 +83,9 @@ public:
      * - GAMEKIT_SUCCESS: The API call was successful.
      * - GAMEKIT_ERROR_MALFORMED_USERNAME: The provided UserName is malformed. Check the output logs to see what the required format is.
      * - GAMEKIT_ERROR_CONFIRM_REGISTRATION_FAILED: The backend web request failed. Check the output logs to see what the error was.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void ConfirmRegistration(const FConfirmRegistrationRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle ConfirmRegistration(const FConfirmRegistrationRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Resend the registration confirmation code to the player's email.
@@ -96,8 +98,9 @@ public:
      * - GAMEKIT_SUCCESS: The API call was successful.
      * - GAMEKIT_ERROR_MALFORMED_USERNAME: The provided UserName is malformed. Check the output logs to see what the required format is.
      * - GAMEKIT_ERROR_RESEND_CONFIRMATION_CODE_FAILED: The backend web request failed. Check the output logs to see what the error was.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void ResendConfirmationCode(const FResendConfirmationCodeRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle ResendConfirmationCode(const FResendConfirmationCodeRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Send a password reset code to the player's email.
@@ -110,8 +113,9 @@ public:
      * - GAMEKIT_SUCCESS: The API call was successful.
      * - GAMEKIT_ERROR_MALFORMED_USERNAME: The provided UserName is malformed. Check the output logs to see what the required format is.
      * - GAMEKIT_ERROR_FORGOT_PASSWORD_FAILED: The backend web request failed. Check the output logs to see what the error was.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void ForgotPassword(const FForgotPasswordRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle ForgotPassword(const FForgotPasswordRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Set the player's new password.
@@ -123,8 +127,9 @@ public:
      * - GAMEKIT_ERROR_MALFORMED_USERNAME: The provided UserName is malformed. Check the output logs to see what the required format is.
      * - GAMEKIT_ERROR_MALFORMED_PASSWORD: The provided Password is malformed. Check the output logs to see what the required format is.
      * - GAMEKIT_ERROR_CONFIRM_FORGOT_PASSWORD_FAILED: The backend web request failed. Check the output logs to see what the error was.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void ConfirmForgotPassword(const FConfirmForgotPasswordRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle ConfirmForgotPassword(const FConfirmForgotPasswordRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Get a login/signup URL for the specified federated identity provider.
@@ -139,8 +144,9 @@ public:
      * Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
      * - GAMEKIT_ERROR_INVALID_FEDERATED_IDENTITY_PROVIDER: The specified federated identity provider is invalid or is not yet supported.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void GetFederatedLoginUrl(const FederatedIdentityProvider_E& IdentityProvider, TAwsGameKitDelegateParam<const IntResult&, const FLoginUrlResponse&> ResultDelegate);
+    static FAwsGameKitOperationHandle GetFederatedLoginUrl(const FederatedIdentityProvider_E& IdentityProvider, TAwsGameKitDelegateParam<const IntResult&, const FLoginUrlResponse&> ResultDelegate);
 
     /**
      * @brief Continually check if the player has completed signing in with the federated identity provider, then store their access tokens in the AwsGameKitSessionManager.
@@ -159,8 +165,9 @@ public:
      * The delegate's ::IntResult parameter is a GameKit status code and indicates the result of the API call. Status codes are defined in errors.h.
      * This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void PollAndRetrieveFederatedTokens(const FPollAndRetrieveFederatedTokensRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FederatedIdentityProvider_E&> ResultDelegate);
+    static FAwsGameKitOperationHandle PollAndRetrieveFederatedTokens(const FPollAndRetrieveFederatedTokensRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FederatedIdentityProvider_E&> ResultDelegate);
 
     /**
      * @brief Get the player's authorized Id token for the specified federated identity provider.
@@ -173,8 +180,9 @@ public:
      * indicates the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
      * - GAMEKIT_ERROR_INVALID_FEDERATED_IDENTITY_PROVIDER: The specified federated identity provider is invalid or is not yet supported.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void GetFederatedIdToken(const FederatedIdentityProvider_E& IdentityProvider, TAwsGameKitDelegateParam<const IntResult&, const FString&> ResultDelegate);
+    static FAwsGameKitOperationHandle GetFederatedIdToken(const FederatedIdentityProvider_E& IdentityProvider, TAwsGameKitDelegateParam<const IntResult&, const FString&> ResultDelegate);
 
     /**
      * @brief Sign in the player through email and password.
@@ -186,19 +194,22 @@ public:
      * @param OnCompleteDelegate The delegate to invoke when this method has completed. The delegate's ::IntResult parameter is a GameKit status code and
      * indicates the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void Login(const FUserLoginRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle Login(const FUserLoginRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Sign out the currently logged in player.
      *
      * @details This revokes the player's access tokens and clears them from the AwsGameKitSessionManager.
+     * It also clears the player's cached User Gameplay Data bundles, see FAwsGameKitUserGameplayDataCache::ClearPlayerData().
      *
      * @param OnCompleteDelegate The delegate to invoke when this method has completed. The delegate's ::IntResult parameter is a GameKit status code and
      * indicates the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void Logout(FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle Logout(FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Get information about the currently logged in player.
@@ -215,6 +226,7 @@ public:
      * - GAMEKIT_ERROR_NO_ID_TOKEN: The player is not logged in.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the output logs to see what the HTTP response code was
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
      */
-    static void GetUser(TAwsGameKitDelegateParam<const IntResult&, const FGetUserResponse&> ResultDelegate);
+    static FAwsGameKitOperationHandle GetUser(TAwsGameKitDelegateParam<const IntResult&, const FGetUserResponse&> ResultDelegate);
 };
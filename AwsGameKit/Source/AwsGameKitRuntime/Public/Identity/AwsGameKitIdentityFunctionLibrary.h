@@ -208,6 +208,7 @@ public:
      * Sign out the currently logged in player.
      *
      * This revokes the player's access tokens and clears them from the AWS GameKit Session Manager.
+     * It also clears the player's cached User Gameplay Data bundles.
      *
      * @param Error A GameKit status code indicating the reason the API call failed. Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
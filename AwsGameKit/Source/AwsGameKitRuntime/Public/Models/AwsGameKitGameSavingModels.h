@@ -4,7 +4,11 @@
 #pragma once
 
 //#include "AwsGameKitCommonModels.h"
+#include "AwsGameKitCore.h"
 #include "GameSaving/AwsGameKitGameSavingWrapper.h"
+#include "GameSaving/AwsGameKitSaveCompression.h"
+#include "GameSaving/AwsGameKitSaveDigest.h"
+#include "GameSaving/AwsGameKitMappedSaveFile.h"
 
 #include "AwsGameKitGameSavingModels.generated.h"  // Last include (Unreal requirement)
 
@@ -52,6 +56,60 @@ enum class SlotSyncStatus_E : uint8
     IN_CONFLICT = 4 UMETA(DisplayName = "Sync Conflict")
 };
 
+/**
+ * How a save file is compressed before it is uploaded, see FGameSavingSaveSlotRequest::Compression.
+ */
+UENUM(BlueprintType)
+enum class GameSavingCompression_E : uint8
+{
+    /**
+     * The save file is uploaded as is.
+     */
+    NONE = 0 UMETA(DisplayName = "None"),
+
+    /**
+     * Zlib: available on every platform, moderate ratio and speed.
+     */
+    ZLIB = 1 UMETA(DisplayName = "Zlib"),
+
+    /**
+     * LZ4: very fast, lower ratio.
+     */
+    LZ4 = 2 UMETA(DisplayName = "LZ4"),
+
+    /**
+     * Oodle: best ratio and fast decompression.
+     */
+    OODLE = 3 UMETA(DisplayName = "Oodle")
+};
+
+/**
+ * The step a streamed save or load is at, see FGameSavingTransferProgress.
+ */
+UENUM(BlueprintType)
+enum class GameSavingTransferPhase_E : uint8
+{
+    /**
+     * The save file is being read from the device.
+     */
+    READING_FILE = 0 UMETA(DisplayName = "Reading File"),
+
+    /**
+     * The save file is being uploaded to the cloud.
+     */
+    UPLOADING = 1 UMETA(DisplayName = "Uploading"),
+
+    /**
+     * The save file is being downloaded from the cloud.
+     */
+    DOWNLOADING = 2 UMETA(DisplayName = "Downloading"),
+
+    /**
+     * The save file is being written to the device.
+     */
+    WRITING_FILE = 3 UMETA(DisplayName = "Writing File")
+};
+
 /**
  * Contains local and cloud information about a cached slot.
  *
@@ -125,6 +183,18 @@ struct FGameSavingSlot
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
     SlotSyncStatus_E SlotSyncStatus;
 
+    /**
+     * The uncompressed size of the local save file in bytes. Equal to SizeLocal unless the slot was saved with compression.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
+    int64 SizeLocalRaw = 0;
+
+    /**
+     * The uncompressed size of the cloud save file in bytes. Equal to SizeCloud unless the slot was saved with compression.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
+    int64 SizeCloudRaw = 0;
+
     /**
      * Create an Unreal-friendly FGameSavingSlot from the plain C++ Slot.
      *
@@ -132,7 +202,7 @@ struct FGameSavingSlot
      */
     static FGameSavingSlot From(const Slot& slot)
     {
-        return FGameSavingSlot
+        FGameSavingSlot gameSavingSlot
         {
             UTF8_TO_TCHAR(slot.slotName),
             UTF8_TO_TCHAR(slot.metadataLocal),
@@ -144,6 +214,14 @@ struct FGameSavingSlot
             slot.lastSync,
             static_cast<SlotSyncStatus_E>(slot.slotSyncStatus)
         };
+
+        // Compressed saves record their uncompressed size in the metadata, and uploads that may be skipped their digest, hide that from the game
+        gameSavingSlot.SizeLocalRaw = gameSavingSlot.SizeLocal;
+        gameSavingSlot.SizeCloudRaw = gameSavingSlot.SizeCloud;
+        gameSavingSlot.MetadataLocal = FAwsGameKitSaveDigest::UntagMetadata(FAwsGameKitSaveCompression::UntagMetadata(gameSavingSlot.MetadataLocal, gameSavingSlot.SizeLocalRaw));
+        gameSavingSlot.MetadataCloud = FAwsGameKitSaveDigest::UntagMetadata(FAwsGameKitSaveCompression::UntagMetadata(gameSavingSlot.MetadataCloud, gameSavingSlot.SizeCloudRaw));
+
+        return gameSavingSlot;
     }
 
     /**
@@ -154,6 +232,7 @@ struct FGameSavingSlot
     static TArray<FGameSavingSlot> ToArray(const Slot* cachedSlots, unsigned int slotCount)
     {
         TArray<FGameSavingSlot> slots;
+        slots.Reserve(slotCount);
         for (unsigned int i = 0; i < slotCount; ++i)
         {
             slots.Add(FGameSavingSlot::From(cachedSlots[i]));
@@ -199,7 +278,7 @@ struct FGameSavingSlotActionResults
     GENERATED_BODY()
 
     /**
-     * A copy of the current set of cached slots.
+     * A copy of the current set of cached slots. Empty when GameKit.GameSaving.SlimResults is set, see FAwsGameKitSlotCache.
      */
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
     FGameSavingSlots Slots;
@@ -218,6 +297,12 @@ struct FGameSavingSlotActionResults
      */
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
     int32 CallStatus = 0;
+
+    /**
+     * Version of FAwsGameKitSlotCache once the acted on slot was applied to it. The cached slots only changed if this differs from the last version seen.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | Game Saving")
+    int64 SlotsVersion = 0;
 };
 
 /**
@@ -232,7 +317,7 @@ struct FGameSavingDataResults
     GENERATED_BODY()
 
     /**
-     * A copy of the current set of cached slots.
+     * A copy of the current set of cached slots. Empty when GameKit.GameSaving.SlimResults is set, see FAwsGameKitSlotCache.
      */
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | LoadSlot")
     FGameSavingSlots Slots;
@@ -257,6 +342,120 @@ struct FGameSavingDataResults
      */
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | LoadSlot")
     int32 CallStatus = 0;
+
+    /**
+     * Version of FAwsGameKitSlotCache once the acted on slot was applied to it. The cached slots only changed if this differs from the last version seen.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | Game Saving | LoadSlot")
+    int64 SlotsVersion = 0;
+};
+
+/**
+ * Progress of AwsGameKitGameSaving::SaveSlotFromFile() and AwsGameKitGameSaving::LoadSlotToFile().
+ */
+USTRUCT(BlueprintType)
+struct FGameSavingTransferProgress
+{
+    GENERATED_BODY()
+
+    /**
+     * The step the transfer is at.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | Game Saving")
+    GameSavingTransferPhase_E Phase = GameSavingTransferPhase_E::READING_FILE;
+
+    /**
+     * Bytes done so far in this phase.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | Game Saving")
+    int64 BytesTransferred = 0;
+
+    /**
+     * Size of the save file in bytes.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | Game Saving")
+    int64 TotalBytes = 0;
+};
+
+/**
+ * Progress of AwsGameKitGameSaving::SyncAllSlots(), reported each time a slot finishes transferring.
+ */
+USTRUCT(BlueprintType)
+struct FGameSavingSyncProgress
+{
+    GENERATED_BODY()
+
+    /**
+     * Number of slots uploaded or downloaded so far, including failed transfers.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | Game Saving")
+    int32 SlotsCompleted = 0;
+
+    /**
+     * Number of slots which need to be uploaded or downloaded.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | Game Saving")
+    int32 SlotsTotal = 0;
+
+    /**
+     * Size in bytes of the slots completed so far.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | Game Saving")
+    int64 BytesTransferred = 0;
+
+    /**
+     * Size in bytes of all the slots which need to be uploaded or downloaded.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | Game Saving")
+    int64 TotalBytes = 0;
+};
+
+/**
+ * This is a response object returned in the delegate of AwsGameKitGameSaving::SyncAllSlots().
+ */
+USTRUCT(BlueprintType)
+struct FGameSavingSyncAllSlotsResults
+{
+    GENERATED_BODY()
+
+    /**
+     * A copy of the cached slots after the last transfer.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
+    FGameSavingSlots Slots;
+
+    /**
+     * Names of the slots that were uploaded to the cloud.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
+    TArray<FString> UploadedSlots;
+
+    /**
+     * Names of the slots that were downloaded from the cloud.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
+    TArray<FString> DownloadedSlots;
+
+    /**
+     * Slots whose SlotSyncStatus is IN_CONFLICT. They are neither uploaded nor downloaded: the game must resolve each conflict,
+     * for example by asking the player, then call SaveSlot() or LoadSlot() with OverrideSync set to true.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
+    TArray<FGameSavingSlot> Conflicts;
+
+    /**
+     * Names of the slots whose upload or download failed. CallStatus is the status of the first failure.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
+    TArray<FString> FailedSlots;
+
+    /**
+     * A GameKit status code which indicates the result of the sync.
+     *
+     * GAMEKIT_SUCCESS if every transfer succeeded, even if there are Conflicts. Otherwise the status of GetAllSlotSyncStatuses() or of the first failed transfer.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
+    int32 CallStatus = 0;
 };
 
 #pragma region Request Objects
@@ -373,6 +572,28 @@ struct FGameSavingSaveSlotRequest
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | SaveSlot")
     bool OverrideSync = false;
 
+    /**
+     * (Optional) Compress the save file on worker threads before uploading it. Defaults to no compression.
+     *
+     * LoadSlot() decompresses the save transparently, whichever compression it was saved with. The compression format and uncompressed size
+     * are recorded in the slot's metadata, which leaves about 40 fewer bytes for your own Metadata.
+     * FGameSavingSlot::SizeLocal and SizeCloud are the compressed sizes, SizeLocalRaw and SizeCloudRaw the uncompressed sizes.
+     * Compressing, and decompressing on load, briefly needs memory for both the compressed and the uncompressed save.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | SaveSlot")
+    GameSavingCompression_E Compression = GameSavingCompression_E::NONE;
+
+    /**
+     * (Optional) Skip the upload when the cloud save is in sync and was uploaded with the same Data, Metadata, EpochTime and Compression.
+     *
+     * A digest of those fields is recorded in the slot's metadata, which leaves about 60 fewer bytes for your own Metadata.
+     * GetSlotSyncStatus() is called before uploading; if the slot is SYNCED and its cloud metadata has the same digest the call completes with
+     * GAMEKIT_ERROR_GAME_SAVING_UPLOAD_SLOT_ALREADY_IN_SYNC and the slot results from GetSlotSyncStatus(). Otherwise the save is uploaded as usual.
+     * Useful for frequent autosaves which often have not changed. With EpochTime 0 a skipped save keeps the timestamp of the earlier upload.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | SaveSlot")
+    bool SkipUploadIfUnchanged = false;
+
     /**
      * Convert this struct into a human-readable string for the purpose of logging.
      */
@@ -445,6 +666,57 @@ struct FGameSavingLoadSlotRequest
         return FString::Format(*formatString, { SlotName, SaveInfoFilePath, overrideSyncString });
     }
 };
+
+/**
+ * The request object for AwsGameKitGameSaving::SyncAllSlots().
+ */
+USTRUCT(BlueprintType)
+struct FGameSavingSyncAllSlotsRequest
+{
+    GENERATED_BODY()
+
+    /**
+     * The absolute path of the folder containing the local save files.
+     *
+     * The save file of each slot is "<SaveDirectory>/<SlotName><SaveFileExtension>", and its SaveInfo.json file is the same path followed by
+     * AwsGameKitGameSaving::GetSaveInfoFileExtension(). Downloaded slots are written to these paths.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | SyncAllSlots")
+    FString SaveDirectory;
+
+    /**
+     * (Optional) The file extension of the save files, including the dot. For example ".sav".
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | SyncAllSlots")
+    FString SaveFileExtension;
+
+    /**
+     * (Optional) The maximum number of slots transferred at the same time. If 0, GameKit.GameSaving.SyncMaxConcurrentTransfers is used.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | SyncAllSlots")
+    int32 MaxConcurrentTransfers = 0;
+
+    /**
+     * (Optional) How uploaded save files are compressed, see FGameSavingSaveSlotRequest::Compression.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | SyncAllSlots")
+    GameSavingCompression_E Compression = GameSavingCompression_E::NONE;
+
+    /**
+     * (Optional) Skip uploading save files that are unchanged since their last upload, see FGameSavingSaveSlotRequest::SkipUploadIfUnchanged.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | SyncAllSlots")
+    bool SkipUploadIfUnchanged = false;
+
+    /**
+     * Convert this struct into a human-readable string for the purpose of logging.
+     */
+    operator FString() const
+    {
+        const FString formatString = FString(TEXT("FGameSavingSyncAllSlotsRequest(SaveDirectory={0}, SaveFileExtension={1}, MaxConcurrentTransfers={2})"));
+        return FString::Format(*formatString, { SaveDirectory, SaveFileExtension, MaxConcurrentTransfers });
+    }
+};
 #pragma endregion
 
 /**
@@ -463,35 +735,245 @@ struct FGameSavingFileIOCallback
 
 /**
  * @brief Used for storing strings while they are being used by the Game Saving low level C API, preventing them from going out scope or being un/re-assigned.
+ *
+ * @details The save file bytes are either owned by the cache, shared with the caller, or mapped from a file, never copied more than once.
+ * Moving a request into the cache moves its Data without copying it, and a shared buffer is only referenced.
+ * The cache can be moved into a lambda but not copied.
  */
 class ModelCache
 {
 private:
     const std::string slotName;
     const std::string saveInfoFilePath;
-    const std::string metadata = "";
+    const FString gameMetadata;
+    std::string metadata = "";
 
     const int64 epochTime = 0;
     const bool overrideSync = false;
-    const TArray<uint8> data;
+    const FName compressionFormat = NAME_None;
+    const bool skipUploadIfUnchanged = false;
+    TArray<uint8> ownedData;
+    TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> sharedData;
+    TUniquePtr<FAwsGameKitMappedSaveFile> mappedFile;
+    FString uploadDigest;
+
+    TArrayView<const uint8> GetSaveData() const
+    {
+        if (mappedFile.IsValid())
+        {
+            return mappedFile->GetData();
+        }
+        return sharedData.IsValid() ? TArrayView<const uint8>(*sharedData) : TArrayView<const uint8>(ownedData);
+    }
+
+    static FName GetCompressionFormat(GameSavingCompression_E compression)
+    {
+        switch (compression)
+        {
+        case GameSavingCompression_E::ZLIB:
+            return NAME_Zlib;
+        case GameSavingCompression_E::LZ4:
+            return NAME_LZ4;
+        case GameSavingCompression_E::OODLE:
+            return NAME_Oodle;
+        default:
+            return NAME_None;
+        }
+    }
+
+    static std::string GetMetadata(const FString& gameMetadata, FName format, int64 rawSize, const FString& digest = FString())
+    {
+        FString saveMetadata = digest.IsEmpty() ? gameMetadata : FAwsGameKitSaveDigest::TagMetadata(gameMetadata, digest);
+        saveMetadata = format.IsNone() ? saveMetadata : FAwsGameKitSaveCompression::TagMetadata(saveMetadata, format, rawSize);
+        return TCHAR_TO_UTF8(ToCStr(saveMetadata));
+    }
 
 public:
     ModelCache(const FGameSavingSaveSlotRequest& request) :
         slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
         saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
-        metadata(TCHAR_TO_UTF8(ToCStr(request.Metadata))),
+        gameMetadata(request.Metadata),
+        metadata(GetMetadata(request.Metadata, GetCompressionFormat(request.Compression), request.Data.Num())),
+        epochTime(request.EpochTime),
+        overrideSync(request.OverrideSync),
+        compressionFormat(GetCompressionFormat(request.Compression)),
+        skipUploadIfUnchanged(request.SkipUploadIfUnchanged),
+        ownedData(request.Data) {}
+
+    ModelCache(FGameSavingSaveSlotRequest&& request) :
+        slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
+        saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
+        gameMetadata(request.Metadata),
+        metadata(GetMetadata(request.Metadata, GetCompressionFormat(request.Compression), request.Data.Num())),
+        epochTime(request.EpochTime),
+        overrideSync(request.OverrideSync),
+        compressionFormat(GetCompressionFormat(request.Compression)),
+        skipUploadIfUnchanged(request.SkipUploadIfUnchanged),
+        ownedData(MoveTemp(request.Data)) {}
+
+    // request.Data is ignored, the bytes are read from data
+    ModelCache(const FGameSavingSaveSlotRequest& request, const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>& data) :
+        slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
+        saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
+        gameMetadata(request.Metadata),
+        metadata(GetMetadata(request.Metadata, GetCompressionFormat(request.Compression), data->Num())),
+        epochTime(request.EpochTime),
+        overrideSync(request.OverrideSync),
+        compressionFormat(GetCompressionFormat(request.Compression)),
+        skipUploadIfUnchanged(request.SkipUploadIfUnchanged),
+        sharedData(data) {}
+
+    // request.Data is ignored, the bytes are read from the mapped file
+    ModelCache(const FGameSavingSaveSlotRequest& request, TUniquePtr<FAwsGameKitMappedSaveFile>&& file) :
+        slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
+        saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
+        gameMetadata(request.Metadata),
+        metadata(GetMetadata(request.Metadata, GetCompressionFormat(request.Compression), file->GetData().Num())),
         epochTime(request.EpochTime),
         overrideSync(request.OverrideSync),
-        data(request.Data) {}
+        compressionFormat(GetCompressionFormat(request.Compression)),
+        skipUploadIfUnchanged(request.SkipUploadIfUnchanged),
+        mappedFile(MoveTemp(file)) {}
 
     ModelCache(const FGameSavingLoadSlotRequest& request) :
         slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
         saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
         overrideSync(request.OverrideSync),
-        data(request.Data) {}
+        ownedData(request.Data) {}
+
+    ModelCache(FGameSavingLoadSlotRequest&& request) :
+        slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
+        saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
+        overrideSync(request.OverrideSync),
+        ownedData(MoveTemp(request.Data)) {}
+
+    ModelCache(const ModelCache&) = delete;
+    ModelCache& operator=(const ModelCache&) = delete;
+    ModelCache(ModelCache&&) = default;
+
+    const char* GetSlotName() const
+    {
+        return slotName.c_str();
+    }
+
+    /**
+     * @brief If the request asked to skip the upload of an unchanged save, compute the digest of this upload and record it in the metadata.
+     *
+     * @details Hashes the save file, so call on a worker thread and before CompressData().
+     * @return False if the request did not ask to skip the upload of an unchanged save.
+     */
+    bool PrepareUploadDigest()
+    {
+        if (!skipUploadIfUnchanged)
+        {
+            return false;
+        }
+
+        const TArrayView<const uint8> data = GetSaveData();
+        uploadDigest = FAwsGameKitSaveDigest::Compute(data, gameMetadata, epochTime, compressionFormat);
+        metadata = GetMetadata(gameMetadata, compressionFormat, data.Num(), uploadDigest);
+        return true;
+    }
+
+    /**
+     * @brief True if PrepareUploadDigest() recorded a digest and it equals CloudDigest, the digest tag of the slot's cloud metadata.
+     */
+    bool MatchesUploadDigest(const FString& CloudDigest) const
+    {
+        return !uploadDigest.IsEmpty() && uploadDigest == CloudDigest;
+    }
+
+    /**
+     * @brief Compress the save file if the request asked for compression. Call on a worker thread before uploading.
+     *
+     * @return False if compression failed.
+     */
+    bool CompressData()
+    {
+        if (compressionFormat.IsNone())
+        {
+            return true;
+        }
+
+        TArray<uint8> compressed;
+        if (!FAwsGameKitSaveCompression::Compress(compressionFormat, GetSaveData(), compressed))
+        {
+            return false;
+        }
+
+        ownedData = MoveTemp(compressed);
+        sharedData.Reset();
+        mappedFile.Reset();
+        return true;
+    }
+
+    /**
+     * @brief Read how the save a LoadSlot call downloaded was compressed from the compression tag in the slot's cloud metadata.
+     *
+     * @return False if the save was not compressed, or LoadedSlot is null.
+     */
+    static bool GetLoadedCompression(const Slot* LoadedSlot, FName& OutFormatName, int64& OutRawSize)
+    {
+        return LoadedSlot != nullptr && LoadedSlot->metadataCloud != nullptr
+            && FAwsGameKitSaveCompression::ReadMetadataTag(UTF8_TO_TCHAR(LoadedSlot->metadataCloud), OutFormatName, OutRawSize);
+    }
+
+    /**
+     * @brief Decompress Data in place if the slot's metadata records that it was saved with compression.
+     *
+     * @return False if the slot was saved with compression but Data could not be decompressed.
+     */
+    static bool DecompressLoadedData(TArray<uint8>& Data, const Slot* LoadedSlot)
+    {
+        FName formatName;
+        int64 rawSize = 0;
+        if (!GetLoadedCompression(LoadedSlot, formatName, rawSize))
+        {
+            return true;
+        }
+
+        TArray<uint8> raw;
+        if (!FAwsGameKitSaveCompression::Decompress(Data, formatName, rawSize, raw))
+        {
+            return false;
+        }
+
+        Data = MoveTemp(raw);
+        return true;
+    }
+
+    /**
+     * @brief Take the buffer a LoadSlot call downloaded into, trimmed to the downloaded size.
+     *
+     * @details When the library reports data inside the cache's own buffer, that buffer is moved out without copying.
+     * Otherwise the data is copied into the cache's buffer first, so there is still only one buffer.
+     */
+    TArray<uint8> TakeLoadedData(const uint8_t* loadedData, unsigned int loadedSize)
+    {
+        if (loadedData != ownedData.GetData())
+        {
+            ownedData.SetNumUninitialized(loadedSize, false);
+            FMemory::Memmove(ownedData.GetData(), loadedData, loadedSize);
+        }
+        else
+        {
+            ownedData.SetNum(FMath::Min<int32>(loadedSize, ownedData.Num()), false);
+        }
+
+        return MoveTemp(ownedData);
+    }
+
+    /**
+     * @brief Take the save file buffer owned by the cache, for example to give it back to FAwsGameKitSaveBufferPool after a save.
+     */
+    TArray<uint8> ReleaseData()
+    {
+        return MoveTemp(ownedData);
+    }
 
     operator GameSavingModel() const
     {
+        const TArrayView<const uint8> data = GetSaveData();
         return
         {
             slotName.c_str(),
@@ -78,6 +78,47 @@ struct FUserGameplayDataBundle
     TMap<FString, FString> BundleMap;
 };
 
+/**
+ *@struct FUserGameplayDataBundleNamesPage
+ *@brief Struct that stores one page of bundle names listed by AwsGameKitUserGameplayData::ListBundlesPaginated()
+ */
+USTRUCT(BlueprintType)
+struct FUserGameplayDataBundleNamesPage
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | Page")
+    TArray<FString> BundleNames;
+
+    /**
+     * Pass this to ListBundlesPaginated() to continue listing after this page.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | Page")
+    FString ContinuationToken;
+};
+
+/**
+ *@struct FUserGameplayDataBundlePage
+ *@brief Struct that stores one page of the items of a bundle retrieved by AwsGameKitUserGameplayData::GetBundlePaginated()
+ */
+USTRUCT(BlueprintType)
+struct FUserGameplayDataBundlePage
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | Page")
+    FString BundleName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | Page")
+    TMap<FString, FString> BundleMap;
+
+    /**
+     * Pass this to GetBundlePaginated() to continue retrieving the bundle after this page.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | Page")
+    FString ContinuationToken;
+};
+
 /**
  *@struct FUserGameplayDataClientSettings
  *@brief Struct that stores the User Gameplay Data API Client settings
@@ -21,7 +21,7 @@
 class AWSGAMEKITRUNTIME_API AwsGameKitSessionManager
 {
 private:
-    static SessionManagerLibrary GetSessionManagerLibraryFromModule();
+    static const SessionManagerLibrary& GetSessionManagerLibraryFromModule();
 public:
     /**
      * @brief Replace any loaded client settings with new settings from the `awsGameKitClientConfig.yml` file.
@@ -25,7 +25,10 @@ class FCacheProcessedDelegate;
 class AWSGAMEKITRUNTIME_API AwsGameKitUserGameplayData
 {
 private:
-    static UserGameplayDataLibrary GetUserGameplayDataLibraryFromModule();
+    static const UserGameplayDataLibrary& GetUserGameplayDataLibraryFromModule();
+
+    // Sends Items to the bundle BundleName in one AddBundle call. Items the backend did not process are returned in OutUnprocessedItems.
+    static IntResult RunAddBundle(const FString& BundleName, const TMap<FString, FString>& Items, TMap<FString, FString>& OutUnprocessedItems);
 
 public:
     /**
@@ -47,8 +50,26 @@ public:
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_DROPPED: The call made to the backend service has been dropped.
      * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The call made to the backend service has been enqueued as connection may be unhealthy and will automatically be retried.
      * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason. 
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
+    */
+    static FAwsGameKitOperationHandle AddBundle(const FUserGameplayDataBundle& userGameplayDataBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate);
+
+    /**
+     * @brief Creates a new bundle or updates BundleItems within a specific bundle for the calling user, for bundles too large for one AddBundle() call.
+     *
+     * @details The bundle is split into batches of GameKit.UserGameplayData.Bulk.BatchSize items, and up to GameKit.UserGameplayData.Bulk.MaxConcurrentBatches
+     * batches are sent at the same time on the User Gameplay Data lane of FAwsGameKitExecutor. Items the backend did not process are sent again, up to GameKit.UserGameplayData.Bulk.MaxRetries times,
+     * waiting GameKit.UserGameplayData.Bulk.RetryBaseSeconds before the first retry and twice as long before each following one.
+     * The waits hold a lane slot, so each batch worker waits at most 0.25 seconds in total; items still unprocessed after that are returned to the delegate.
+     *
+     * @param userGameplayDataBundle Struct holding the bundle name and the items being added.
+     * @param ResultDelegate Delegate that processes the merged result of every batch.
+     * The ::IntResult (part of the `ResultDelegate` parameter) is GAMEKIT_SUCCESS if every item was processed, otherwise the status code of the first batch that failed.
+     * The ::FUserGameplayDataBundle (part of the `ResultDelegate` parameter) contains the items of every batch that were still unprocessed after the last retry.
+     * This method's possible status codes are the ones listed for AddBundle().
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle. Cancelling it stops sending the batches that have not been sent yet.
     */
-    static void AddBundle(const FUserGameplayDataBundle& userGameplayDataBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate);
+    static FAwsGameKitOperationHandle AddBundleBulk(const FUserGameplayDataBundle& userGameplayDataBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate);
 
     /**
      * @brief Applies the settings to the User Gameplay Data Client. Should be called immediately after the instance has been created and before any other API calls.
@@ -71,12 +92,37 @@ public:
      * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The call made to the backend service has been enqueued as connection may be unhealthy and will automatically be retried.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The response body from the backend could not be parsed successfully
      * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
+    */
+    static FAwsGameKitOperationHandle ListBundles(TAwsGameKitDelegateParam<const IntResult&, const TArray<FString>&> ResultDelegate);
+
+    /**
+     * @brief Lists the bundle name of every bundle that the calling user owns, and will call a delegate after every page.
+     *
+     * @details Pages hold FUserGameplayDataClientSettings::PaginationSize bundle names, see SetClientSettings(), and are delivered as the bundles are received
+     * rather than after all of them have been listed. The last page may be smaller.
+     *
+     * Pass the ContinuationToken of the last page received to list the bundles after it, for example after the call was cancelled.
+     * The token is the last bundle name of that page, and bundles are listed in ascending name order, so bundles added or deleted in between
+     * do not shift the bundles that are delivered after it. The backend cannot resume a listing, so the bundles before the token are listed again,
+     * but they are not delivered.
+     *
+     * @param ContinuationToken Empty to list from the first bundle, otherwise the ContinuationToken of a page returned by an earlier call.
+     * @param PartialResultDelegate Delegate that processes the most recently listed page of bundle names.
+     * @param OperationCompleteDelegate Delegate that processes the status code after all pages have been listed.
+     * Status codes are defined in errors.h. This method's possible status codes are the ones listed for ListBundles().
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void ListBundles(TAwsGameKitDelegateParam<const IntResult&, const TArray<FString>&> ResultDelegate);
+    static FAwsGameKitOperationHandle ListBundlesPaginated(const FString& ContinuationToken,
+        TAwsGameKitDelegateParam<const FUserGameplayDataBundleNamesPage&> PartialResultDelegate,
+        FAwsGameKitStatusDelegateParam OperationCompleteDelegate);
 
     /**
      * @brief Gets all items that are associated with a certain bundle for the calling user.
      *
+     * @details While the bundle is in FAwsGameKitUserGameplayDataCache, the delegate is invoked before this returns, and the returned handle is empty.
+     * Bundles fetched from the backend are added to the cache.
+     *
      * @param UserGameplayDataBundleName The name of the bundle that is being retrieved.
      * @param ResultDelegate Delegate that processes the status code and returned bundle.
      * The ::IntResult (part of the `ResultDelegate` parameter) is a GameKit status code and indicates the result of the API call.
@@ -90,12 +136,39 @@ public:
      * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The call made to the backend service has been enqueued as connection may be unhealthy and will automatically be retried.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The response body from the backend could not be parsed successfully
      * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
+    */
+    static FAwsGameKitOperationHandle GetBundle(const FString& UserGameplayDataBundleName, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate);
+
+    /**
+     * @brief Gets all items that are associated with a certain bundle for the calling user, and will call a delegate after every page.
+     *
+     * @details Pages hold FUserGameplayDataClientSettings::PaginationSize items, see SetClientSettings(), and are delivered as the items are received
+     * rather than after the whole bundle has been retrieved. The last page may be smaller.
+     *
+     * Pass the ContinuationToken of the last page received to retrieve the items after it. The token is the last item key of that page,
+     * and items are retrieved in ascending key order, so items added or deleted in between do not shift the items that are delivered after it.
+     * The backend cannot resume a retrieval, so the items before the token are retrieved again, but they are not delivered.
+     *
+     * Unlike GetBundle(), this always calls the backend and does not add the bundle to FAwsGameKitUserGameplayDataCache.
+     *
+     * @param UserGameplayDataBundleName The name of the bundle that is being retrieved.
+     * @param ContinuationToken Empty to retrieve from the first item, otherwise the ContinuationToken of a page returned by an earlier call for the same bundle.
+     * @param PartialResultDelegate Delegate that processes the most recently retrieved page of items.
+     * @param OperationCompleteDelegate Delegate that processes the status code after all pages have been retrieved.
+     * Status codes are defined in errors.h. This method's possible status codes are the ones listed for GetBundle().
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void GetBundle(const FString& UserGameplayDataBundleName, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate);
+    static FAwsGameKitOperationHandle GetBundlePaginated(const FString& UserGameplayDataBundleName,
+        const FString& ContinuationToken,
+        TAwsGameKitDelegateParam<const FUserGameplayDataBundlePage&> PartialResultDelegate,
+        FAwsGameKitStatusDelegateParam OperationCompleteDelegate);
 
     /**
      * @brief Gets a single item that is associated with a certain bundle for a user.
      *
+     * @details While the item's bundle is in FAwsGameKitUserGameplayDataCache, the delegate is invoked before this returns, and the returned handle is empty.
+     *
      * @param userGameplayDataBundleItem Struct holding the bundle name and bundle item that should be retrieved.
      * @param ResultDelegate Delegate that processes the status code and returned bundle item.
      * The ::IntResult (part of the `ResultDelegate` parameter) is a GameKit status code and indicates the result of the API call.
@@ -109,8 +182,9 @@ public:
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_DROPPED: The call made to the backend service has been dropped.
      * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The call made to the backend service has been enqueued as connection may be unhealthy and will automatically be retried.
      * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void GetBundleItem(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> ResultDelegate);
+    static FAwsGameKitOperationHandle GetBundleItem(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> ResultDelegate);
 
     /**
      * @brief Updates the value of an existing item inside a bundle with new item data.
@@ -128,8 +202,30 @@ public:
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_DROPPED: The call made to the backend service has been dropped.
      * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The call made to the backend service has been enqueued as connection may be unhealthy and will automatically be retried.
      * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
+    */
+    static FAwsGameKitOperationHandle UpdateItem(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+
+    /**
+     * @brief Buffers a write of an item, replacing any buffered write of the same bundle item, and sends the buffered writes as one AddBundle call per bundle.
+     *
+     * @details Use this instead of UpdateItem() for items written often, such as progress counters. Writes are collected for
+     * GameKit.UserGameplayData.WriteBuffer.WindowSeconds, or until GameKit.UserGameplayData.WriteBuffer.MaxItems items are buffered, a new map is loaded,
+     * or FlushBufferedWrites() is called. See FAwsGameKitUserGameplayDataWriteBuffer.
+     *
+     * Unlike UpdateItem(), the item does not have to exist yet.
+     *
+     * @param userGameplayDataBundleItemValue Struct holding the bundle name, bundle item, and new item data.
+     * @param OnCompleteDelegate Delegate that processes the status code after the buffered write has been sent.
+     * The `OnCompleteDelegate` parameter takes an ::IntResult with the result of the write that was finally sent for the item, which is the last one buffered.
+     * This method's possible status codes are the ones listed for AddBundle(). Writes still buffered when the player logs out are dropped with GAMEKIT_ERROR_NO_ID_TOKEN.
+    */
+    static void UpdateItemBuffered(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+
+    /**
+     * @brief Sends every write buffered by UpdateItemBuffered() now. Call this before quitting the game, buffered writes are dropped on shutdown.
     */
-    static void UpdateItem(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static void FlushBufferedWrites();
 
     /**
      * @brief Permanently deletes all bundles associated with a user.
@@ -144,8 +240,9 @@ public:
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_DROPPED: The call made to the backend service has been dropped.
      * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The call made to the backend service has been enqueued as connection may be unhealthy and will automatically be retried.
      * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void DeleteAllData(FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle DeleteAllData(FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Permanently deletes an entire bundle, along with all corresponding items, associated with a user.
@@ -162,8 +259,9 @@ public:
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_DROPPED: The call made to the backend service has been dropped.
      * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The call made to the backend service has been enqueued as connection may be unhealthy and will automatically be retried.
      * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void DeleteBundle(const FString& UserGameplayDataBundleName, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle DeleteBundle(const FString& UserGameplayDataBundleName, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Permanently deletes a list of items inside of a bundle associated with a user.
@@ -182,8 +280,9 @@ public:
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_DROPPED: The call made to the backend service has been dropped.
      * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The call made to the backend service has been enqueued as connection may be unhealthy and will automatically be retried.
      * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void DeleteBundleItems(const FUserGameplayDataDeleteItemsRequest& userGameplayDataBundleItemsDeleteRequest, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle DeleteBundleItems(const FUserGameplayDataDeleteItemsRequest& userGameplayDataBundleItemsDeleteRequest, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Start the Retry background thread.
@@ -225,8 +324,9 @@ public:
      * Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_WRITE_FAILED: There was an issue writing the queue to the offline cache file.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void PersistToCache(const FString& cacheFile, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle PersistToCache(const FString& cacheFile, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
     /**
      * @brief Read the pending API calls from cache.
@@ -239,6 +339,7 @@ public:
      * Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_READ_FAILED: There was an issue loading the offline cache file to the queue.
+     * @return Handle to cancel the call or give it a deadline, see FAwsGameKitOperationHandle.
     */
-    static void LoadFromCache(const FString& cacheFile, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+    static FAwsGameKitOperationHandle LoadFromCache(const FString& cacheFile, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 };
@@ -0,0 +1,117 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/DateTime.h"
+
+/**
+ * @brief A read-through cache of User Gameplay Data bundles, keyed by bundle name.
+ *
+ * @details AwsGameKitUserGameplayData::GetBundle() and GetBundleItem() complete synchronously from this cache while the bundle was fetched less than
+ * GameKit.UserGameplayData.Cache.TtlSeconds ago, without queueing work or calling the backend. The cache is disabled while that value is zero, which is the default.
+ *
+ * Every bundle has a version that changes whenever its cached contents are stored or invalidated. AddBundle(), UpdateItem(), DeleteBundle() and DeleteBundleItems()
+ * invalidate the bundle they write to, and DeleteAllData() clears the cache. A fetch that was started before the bundle was invalidated is not stored,
+ * so a read that races a write never caches the old contents.
+ *
+ * The cache holds one player's data. AwsGameKitIdentity::Logout() calls ClearPlayerData(), which also deletes the files the cache was saved to or loaded from.
+ * SaveToFile() and LoadFromFile() keep the cache across sessions; loaded bundles keep the time they were fetched, so the TTL still applies to them.
+ * The file records the player it was saved for, and LoadFromFile() rejects a file saved for another player, for example one left behind by a crash.
+ *
+ * All methods may be called from any thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataCache
+{
+public:
+    static FAwsGameKitUserGameplayDataCache& Get();
+
+    /**
+     * @brief True if GameKit.UserGameplayData.Cache.TtlSeconds is greater than zero.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Copy the items of BundleName into OutItems.
+     *
+     * @return False if the cache is disabled, or the bundle is not cached or has expired.
+     */
+    bool FindBundle(const FString& BundleName, TMap<FString, FString>& OutItems);
+
+    /**
+     * @brief Copy the value of the item ItemKey of BundleName into OutValue.
+     *
+     * @return False if the cache is disabled, or the bundle is not cached, has expired, or has no such item.
+     */
+    bool FindItem(const FString& BundleName, const FString& ItemKey, FString& OutValue);
+
+    /**
+     * @brief The current version of BundleName. Take it before fetching the bundle and pass it to Store().
+     */
+    int64 GetVersion(const FString& BundleName);
+
+    /**
+     * @brief Cache the items of BundleName that were fetched from the backend.
+     *
+     * @param FetchedVersion The version returned by GetVersion() before the fetch was started. Nothing is stored if the bundle has changed since.
+     */
+    void Store(const FString& BundleName, const TMap<FString, FString>& Items, int64 FetchedVersion);
+
+    /**
+     * @brief Drop BundleName from the cache because it has been written to.
+     */
+    void Invalidate(const FString& BundleName);
+
+    /**
+     * @brief Drop every bundle from the cache.
+     */
+    void Clear();
+
+    /**
+     * @brief Clear() the cache and delete every file this session saved with SaveToFile() or loaded with LoadFromFile(), so the next player cannot read the bundles.
+     */
+    void ClearPlayerData();
+
+    /**
+     * @brief Write every cached bundle to FilePath.
+     *
+     * @param PlayerId The player the cache holds data for, for example FGetUserResponse::UserId.
+     */
+    bool SaveToFile(const FString& FilePath, const FString& PlayerId);
+
+    /**
+     * @brief Add the bundles written by SaveToFile() to the cache. Bundles that are already cached are kept.
+     *
+     * @param PlayerId The player who is logged in. The file is rejected if SaveToFile() wrote it for another player.
+     */
+    bool LoadFromFile(const FString& FilePath, const FString& PlayerId);
+
+private:
+    struct FEntry
+    {
+        FDateTime FetchTime;
+        TMap<FString, FString> Items;
+    };
+
+    // Returns the cached bundle if it has not expired. Call with the mutex held.
+    const FEntry* FindFresh(const FString& BundleName) const;
+
+    int64 GetVersionLocked(const FString& BundleName) const;
+
+    TMap<FString, FEntry> bundles;
+
+    // Bundle versions are taken from one counter, so a version is never reused after Clear()
+    TMap<FString, int64> versions;
+    int64 versionCounter = 0;
+    int64 clearedVersion = 0;
+
+    // Files saved with SaveToFile() or loaded with LoadFromFile(), deleted by ClearPlayerData()
+    TSet<FString> filePaths;
+
+    FCriticalSection mutex;
+};
@@ -18,6 +18,9 @@
 #endif
 #include <aws/gamekit/user-gameplay-data/gamekit_user_gameplay_data_models.h>
 
+// Unreal
+#include "Templates/Function.h"
+
 // Standard library
 #include <string>
 
@@ -135,6 +138,15 @@ public:
      */
     virtual unsigned int GameKitListUserGameplayDataBundles(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TArray<FString>& inOutData);
 
+    /**
+     * @brief Gets all bundles that a player currently owns, passing each bundle name to onBundle as the library reports it instead of gathering them.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitUserGameplayData instance created with GameKitUserGameplayDataInstanceCreateWithSessionManager()
+     * @param onBundle Called with the name of every bundle, on the calling thread, before this returns.
+     * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+     */
+    virtual unsigned int GameKitListUserGameplayDataBundlesStreamed(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TFunctionRef<void(const char* bundleName)> onBundle);
+
     /**
      * @brief Gets user gameplay data stored for the calling user from a specific bundle.
      *
@@ -145,6 +157,16 @@ public:
      */
     virtual unsigned int GameKitGetUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TMap<FString, FString>& inOutData, char* bundleName);
 
+    /**
+     * @brief Gets user gameplay data stored for the calling user from a specific bundle, passing each item to onItem as the library reports it instead of gathering them.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitUserGameplayData instance created with GameKitUserGameplayDataInstanceCreateWithSessionManager().
+     * @param bundleName The name of the bundle that should be referenced in DyanmoDB.
+     * @param onItem Called with the key and value of every item, on the calling thread, before this returns.
+     * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+     */
+    virtual unsigned int GameKitGetUserGameplayDataBundleStreamed(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, TFunctionRef<void(const char* key, const char* value)> onItem);
+
     /**
      * @brief Gets a single stored item from a specific bundle for the calling user.
      *
@@ -0,0 +1,96 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntimePublicHelpers.h"
+#include "Models/AwsGameKitUserGameplayDataModels.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/Ticker.h"
+#include "Containers/UnrealString.h"
+#include "Delegates/IDelegateInstance.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Buffers User Gameplay Data item writes and sends them as one AddBundle call per bundle, see AwsGameKitUserGameplayData::UpdateItemBuffered().
+ *
+ * @details Writes to the same bundle item replace each other while they are buffered, so only the last value is sent. The buffer is flushed:
+ * - GameKit.UserGameplayData.WriteBuffer.WindowSeconds after the first write into an empty buffer,
+ * - once GameKit.UserGameplayData.WriteBuffer.MaxItems items are buffered,
+ * - before a new map is loaded,
+ * - when Flush() is called.
+ *
+ * AwsGameKitIdentity::Logout() calls DiscardPlayerWrites(), so writes buffered for one player are never sent for the next one.
+ *
+ * Every write invalidates its bundle in FAwsGameKitUserGameplayDataCache when it is buffered, like UpdateItem() does.
+ *
+ * Every buffered write's delegate is invoked with the result of the write that was finally sent for its item (last write wins).
+ * Items that the backend did not process report the AddBundle failure, the other items of the same bundle report success.
+ *
+ * All methods may be called from any thread. Delegates are invoked on the game thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataWriteBuffer
+{
+public:
+    static FAwsGameKitUserGameplayDataWriteBuffer& Get();
+
+    /**
+     * @brief Start flushing on a timer and on map loads. Called by the AwsGameKitRuntime module on startup.
+     */
+    void Startup();
+
+    /**
+     * @brief Stop the timer. Called by the AwsGameKitRuntime module on shutdown.
+     *
+     * @details Work can no longer be started at that point, so writes still buffered are dropped with a warning. Call Flush() before quitting the game.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Buffer a write of Item, replacing any buffered write of the same bundle item.
+     */
+    void Write(const FUserGameplayDataBundleItemValue& Item, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+
+    /**
+     * @brief Send every buffered write now, one AddBundle call per bundle.
+     */
+    void Flush();
+
+    /**
+     * @brief Drop every buffered write without sending it. Their delegates are invoked with GAMEKIT_ERROR_NO_ID_TOKEN.
+     */
+    void DiscardPlayerWrites();
+
+    /**
+     * @brief Number of bundle items waiting to be sent.
+     */
+    int32 GetBufferedItemCount();
+
+private:
+    struct FBufferedItem
+    {
+        FString Value;
+        TArray<FAwsGameKitStatusDelegate> Delegates;
+    };
+
+    typedef TMap<FString, FBufferedItem> FBufferedBundle;
+
+    bool Tick(float DeltaTime);
+    void OnPreLoadMap(const FString& MapName);
+
+    static void SendBundle(const FString& BundleName, FBufferedBundle&& Items);
+
+    TMap<FString, FBufferedBundle> bundles;
+    int32 itemCount = 0;
+    int32 coalescedCount = 0;
+
+    // FPlatformTime::Seconds() when the buffer is next flushed, zero while it is empty
+    double flushTime = 0.0;
+
+    FCriticalSection mutex;
+    FTSTicker::FDelegateHandle tickerHandle;
+    FDelegateHandle preLoadMapHandle;
+};